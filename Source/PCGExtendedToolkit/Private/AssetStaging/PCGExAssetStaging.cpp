@@ -216,6 +216,12 @@ namespace PCGExAssetStaging
 		Helper = MakeShared<PCGExStaging::TDistributionHelper<UPCGExAssetCollection, FPCGExAssetCollectionEntry>>(Context->MainCollection, Settings->DistributionSettings);
 		if (!Helper->Init(PointDataFacade)) { return false; }
 
+		if (Helper->SupportsBulkPicks())
+		{
+			PointSeeds.SetNumUninitialized(NumPoints);
+			EntryPicks.SetNumUninitialized(NumPoints);
+		}
+
 		bOutputWeight = Settings->WeightToAttribute != EPCGExWeightOutputMode::NoOutput;
 		bNormalizedWeight = Settings->WeightToAttribute != EPCGExWeightOutputMode::Raw;
 		bOneMinusWeight = Settings->WeightToAttribute == EPCGExWeightOutputMode::NormalizedInverted || Settings->WeightToAttribute == EPCGExWeightOutputMode::NormalizedInvertedToDensity;
@@ -307,6 +313,19 @@ namespace PCGExAssetStaging
 			if (Context->bPickMaterials) { MaterialPick[Index] = -1; }
 		};
 
+		const bool bBulkPicks = !EntryPicks.IsEmpty();
+		if (bBulkPicks)
+		{
+			PCGEX_SCOPE_LOOP(Index)
+			{
+				PointSeeds[Index] = PCGExRandom::GetSeed(
+					Seeds[Index], Helper->Details.SeedComponents,
+					Helper->Details.LocalSeed, Settings, Context->GetComponent());
+			}
+
+			Helper->GetPicks(Scope, PointSeeds, EntryPicks);
+		}
+
 		PCGEX_SCOPE_LOOP(Index)
 		{
 			if (!PointFilterCache[Index])
@@ -320,11 +339,21 @@ namespace PCGExAssetStaging
 			const FPCGExAssetCollectionEntry* Entry = nullptr;
 			const UPCGExAssetCollection* EntryHost = nullptr;
 
-			const int32 Seed = PCGExRandom::GetSeed(
-				Seeds[Index], Helper->Details.SeedComponents,
-				Helper->Details.LocalSeed, Settings, Context->GetComponent());
+			int32 Seed = 0;
 
-			Helper->GetEntry(Entry, Index, Seed, EntryHost);
+			if (bBulkPicks)
+			{
+				Seed = PointSeeds[Index];
+				Helper->GetEntryFromPick(Entry, EntryPicks[Index], Seed, EntryHost);
+			}
+			else
+			{
+				Seed = PCGExRandom::GetSeed(
+					Seeds[Index], Helper->Details.SeedComponents,
+					Helper->Details.LocalSeed, Settings, Context->GetComponent());
+
+				Helper->GetEntry(Entry, Index, Seed, EntryHost);
+			}
 
 			if (!Entry || !Entry->Staging.Bounds.IsValid)
 			{
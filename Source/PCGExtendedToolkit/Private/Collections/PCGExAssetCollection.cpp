@@ -20,6 +20,97 @@
 
 namespace PCGExAssetCollection
 {
+	void FAliasTable::Build(TConstArrayView<int32> InWeights)
+	{
+		const int32 NumWeights = InWeights.Num();
+
+		Thresholds.SetNumUninitialized(NumWeights);
+		Aliases.SetNumUninitialized(NumWeights);
+		Capacity = 0;
+
+		if (!NumWeights) { return; }
+
+		TArray<int64> Scaled;
+		Scaled.SetNumUninitialized(NumWeights);
+
+		int64 Total = 0;
+		for (int32 i = 0; i < NumWeights; i++)
+		{
+			Scaled[i] = FMath::Max(0, InWeights[i]);
+			Total += Scaled[i];
+		}
+
+		// Rolls are 32 bits wide; coarsen absurdly large weights rather than overflow
+		int32 Shift = 0;
+		while ((Total >> Shift) > MAX_uint32) { Shift++; }
+
+		if (Shift)
+		{
+			Total = 0;
+			for (int64& W : Scaled)
+			{
+				if (W) { W = FMath::Max<int64>(1, W >> Shift); }
+				Total += W;
+			}
+		}
+
+		if (Total <= 0)
+		{
+			// Degenerate weights, fall back to uniform
+			Capacity = 1;
+			for (int32 i = 0; i < NumWeights; i++)
+			{
+				Thresholds[i] = 1;
+				Aliases[i] = i;
+			}
+			return;
+		}
+
+		Capacity = static_cast<uint32>(Total);
+
+		// Scale by the number of columns so a full column holds exactly Total; integer math keeps the split exact
+		TArray<int32> Small;
+		TArray<int32> Large;
+		Small.Reserve(NumWeights);
+		Large.Reserve(NumWeights);
+
+		for (int32 i = 0; i < NumWeights; i++)
+		{
+			Scaled[i] *= NumWeights;
+			if (Scaled[i] < Total) { Small.Add(i); }
+			else { Large.Add(i); }
+		}
+
+		while (!Small.IsEmpty() && !Large.IsEmpty())
+		{
+			const int32 S = Small.Pop(EAllowShrinking::No);
+			const int32 L = Large.Last();
+
+			Thresholds[S] = static_cast<uint32>(Scaled[S]);
+			Aliases[S] = L;
+
+			Scaled[L] -= Total - Scaled[S];
+			if (Scaled[L] < Total)
+			{
+				Large.Pop(EAllowShrinking::No);
+				Small.Add(L);
+			}
+		}
+
+		// Leftovers are full columns
+		for (const int32 i : Large)
+		{
+			Thresholds[i] = Capacity;
+			Aliases[i] = i;
+		}
+
+		for (const int32 i : Small)
+		{
+			Thresholds[i] = Capacity;
+			Aliases[i] = i;
+		}
+	}
+
 	int32 FCategory::GetPick(const int32 Index, const EPCGExIndexPickMode PickMode) const
 	{
 		switch (PickMode)
@@ -65,10 +156,18 @@ namespace PCGExAssetCollection
 	int32 FCategory::GetPickRandomWeighted(const int32 Seed) const
 	{
 		if (Order.IsEmpty()) { return -1; }
-		const int32 Threshold = FRandomStream(Seed).RandRange(0, WeightSum - 1);
-		int32 Pick = 0;
-		while (Pick < Weights.Num() && Weights[Pick] < Threshold) { Pick++; }
-		return Indices[Order[Pick]];
+		return Indices[Order[AliasTable.Pick(Seed)]];
+	}
+
+	void FCategory::GetPickRandomWeighted(const PCGExMT::FScope& Scope, TConstArrayView<int32> Seeds, TArrayView<int32> OutPicks) const
+	{
+		if (Order.IsEmpty())
+		{
+			PCGEX_SCOPE_LOOP(Index) { OutPicks[Index] = -1; }
+			return;
+		}
+
+		PCGEX_SCOPE_LOOP(Index) { OutPicks[Index] = Indices[Order[AliasTable.Pick(Seeds[Index])]]; }
 	}
 
 	void FCategory::Reserve(const int32 Num)
@@ -103,6 +202,9 @@ namespace PCGExAssetCollection
 		Order.Sort([&](const int32 A, const int32 B) { return Weights[A] < Weights[B]; });
 		Weights.Sort([](const int32 A, const int32 B) { return A < B; });
 
+		// Built before weights become cumulative
+		AliasTable.Build(Weights);
+
 		WeightSum = 0;
 		for (int32 i = 0; i < NumEntries; i++)
 		{
@@ -190,6 +190,7 @@ namespace PCGExDataBlending
 			if (!Buffer->OutAttribute) { continue; }
 			if (!TargetFacade->GetIn()->Metadata->HasAttribute(Buffer->OutAttribute->Name))
 			{
+				TargetFacade->Source->MaterializeOutput();
 				TargetFacade->GetOut()->Metadata->DeleteAttribute(Buffer->OutAttribute->Name);
 				// TODO : Check types and make sure we're not deleting something
 			}
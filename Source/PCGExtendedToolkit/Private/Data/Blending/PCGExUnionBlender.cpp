@@ -255,7 +255,18 @@ namespace PCGExDataBlending
 		, const bool bWantsDirectAccess)
 	{
 		CurrentUnionMetadata = InUnionMetadata;
-		return Init(InContext, TargetData, bWantsDirectAccess);
+		if (!Init(InContext, TargetData, bWantsDirectAccess)) { return false; }
+
+		FlatSources.Reset();
+
+		if (CurrentUnionMetadata && CurrentUnionMetadata->IsFlat())
+		{
+			const TArray<PCGExData::FElement>& FlatElements = CurrentUnionMetadata->FlatElements;
+			FlatSources.SetNumUninitialized(FlatElements.Num());
+			for (int32 i = 0; i < FlatElements.Num(); i++) { FlatSources[i] = IOLookup->Get(FlatElements[i].IO); }
+		}
+
+		return true;
 	}
 
 	int32 FUnionBlender::ComputeWeights(const int32 WriteIndex, const TSharedPtr<PCGExData::IUnionData>& InUnionData, TArray<PCGExData::FWeightedPoint>& OutWeightedPoints) const
@@ -264,6 +275,31 @@ namespace PCGExDataBlending
 		return InUnionData->ComputeWeights(SourcesData, IOLookup, Target, DistanceDetails, OutWeightedPoints);
 	}
 
+	int32 FUnionBlender::ComputeFlatWeights(const int32 UnionIndex, TArray<PCGExData::FWeightedPoint>& OutWeightedPoints) const
+	{
+		const PCGExData::FConstPoint Target = CurrentTargetData->Source->GetOutPoint(UnionIndex);
+
+		const int32 Start = CurrentUnionMetadata->FlatOffsets[UnionIndex];
+		const int32 End = CurrentUnionMetadata->FlatOffsets[UnionIndex + 1];
+		const PCGExData::FElement* Elements = CurrentUnionMetadata->FlatElements.GetData();
+
+		OutWeightedPoints.Reset(End - Start);
+
+		double MaxWeight = 0;
+
+		for (int32 i = Start; i < End; i++)
+		{
+			const int32 SourceIndex = FlatSources[i];
+			if (SourceIndex == -1) { continue; }
+
+			PCGExData::FWeightedPoint& P = OutWeightedPoints.Emplace_GetRef(Elements[i].Index, 0, SourceIndex);
+			P.Weight = DistanceDetails->GetDistSquared(PCGExData::FConstPoint(SourcesData[SourceIndex], P), Target);
+			MaxWeight = FMath::Max(MaxWeight, P.Weight);
+		}
+
+		return PCGExData::FinalizeUnionWeights(OutWeightedPoints, MaxWeight);
+	}
+
 	void FUnionBlender::Blend(const int32 WriteIndex, const TArray<PCGExData::FWeightedPoint>& InWeightedPoints, TArray<PCGEx::FOpStats>& Trackers) const
 	{
 		if (InWeightedPoints.IsEmpty()) { return; }
@@ -295,7 +331,12 @@ namespace PCGExDataBlending
 
 	void FUnionBlender::MergeSingle(const int32 UnionIndex, TArray<PCGExData::FWeightedPoint>& OutWeightedPoints, TArray<PCGEx::FOpStats>& Trackers) const
 	{
-		if (!ComputeWeights(UnionIndex, CurrentUnionMetadata->Get(UnionIndex), OutWeightedPoints)) { return; }
+		if (!FlatSources.IsEmpty() && CurrentUnionMetadata->IsFlat())
+		{
+			if (!ComputeFlatWeights(UnionIndex, OutWeightedPoints)) { return; }
+		}
+		else if (!ComputeWeights(UnionIndex, CurrentUnionMetadata->Get(UnionIndex), OutWeightedPoints)) { return; }
+
 		Blend(UnionIndex, OutWeightedPoints, Trackers);
 	}
 
@@ -87,6 +87,13 @@ template PCGEXTENDEDTOOLKIT_API bool IBuffer::IsA<_TYPE>() const;
 	template <typename T>
 	void TBuffer<T>::DumpValues(const TSharedPtr<TArray<T>>& OutValues) const { DumpValues(*OutValues.Get()); }
 
+	template <typename T>
+	void TBuffer<T>::ReadScope(const PCGExMT::FScope& Scope, TArrayView<T> OutValues) const
+	{
+		check(OutValues.Num() >= Scope.Count)
+		for (int i = 0; i < Scope.Count; i++) { OutValues[i] = Read(Scope.Start + i); }
+	}
+
 	template <typename T>
 	TArrayBuffer<T>::TArrayBuffer(const TSharedRef<FPointIO>& InSource, const FPCGAttributeIdentifier& InIdentifier):
 		TBuffer<T>(InSource, InIdentifier)
@@ -113,6 +120,14 @@ template PCGEXTENDEDTOOLKIT_API bool IBuffer::IsA<_TYPE>() const;
 	template <typename T>
 	const T& TArrayBuffer<T>::Read(const int32 Index) const { return *(InValues->GetData() + Index); }
 
+	template <typename T>
+	void TArrayBuffer<T>::ReadScope(const PCGExMT::FScope& Scope, TArrayView<T> OutValues) const
+	{
+		check(OutValues.Num() >= Scope.Count)
+		const T* InData = InValues->GetData() + Scope.Start;
+		for (int i = 0; i < Scope.Count; i++) { OutValues[i] = InData[i]; }
+	}
+
 	template <typename T>
 	const T& TArrayBuffer<T>::GetValue(const int32 Index) { return *(OutValues->GetData() + Index); }
 
@@ -425,6 +440,13 @@ template PCGEXTENDEDTOOLKIT_API bool IBuffer::IsA<_TYPE>() const;
 		return InValue;
 	}
 
+	template <typename T>
+	void TSingleValueBuffer<T>::ReadScope(const PCGExMT::FScope& Scope, TArrayView<T> OutValues) const
+	{
+		check(OutValues.Num() >= Scope.Count)
+		for (int i = 0; i < Scope.Count; i++) { OutValues[i] = InValue; }
+	}
+
 	template <typename T>
 	const T& TSingleValueBuffer<T>::GetValue(const int32 Index)
 	{
@@ -145,6 +145,7 @@ void FPCGExCarryOverDetails::Prune(TArray<FString>& InValues) const
 
 void FPCGExCarryOverDetails::Prune(const PCGExData::FPointIO* PointIO) const
 {
+	PointIO->MaterializeOutput();
 	Prune(PointIO->GetOut()->Metadata);
 	Prune(PointIO->Tags.Get());
 }
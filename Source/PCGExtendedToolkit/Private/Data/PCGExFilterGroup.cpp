@@ -118,6 +118,57 @@ namespace PCGExFilterGroup
 	{
 		InFilter->PostInit();
 	}
+
+	void FFilterGroupAND::TestRange(const PCGExMT::FScope& Scope, TArrayView<int8> InOutMask) const
+	{
+		if (!bInvert)
+		{
+			for (const TSharedPtr<PCGExPointFilter::IFilter>& Filter : ManagedFilters)
+			{
+				Filter->TestRange(Scope, InOutMask);
+				if (!PCGExPointFilter::AnyPass(InOutMask)) { return; }
+			}
+
+			return;
+		}
+
+		// Inverted, a live lane passes if any filter fails
+		TArray<int8> AllPass(InOutMask.GetData(), Scope.Count);
+		for (const TSharedPtr<PCGExPointFilter::IFilter>& Filter : ManagedFilters)
+		{
+			Filter->TestRange(Scope, AllPass);
+			if (!PCGExPointFilter::AnyPass(AllPass)) { break; }
+		}
+
+		for (int i = 0; i < Scope.Count; i++) { InOutMask[i] &= !AllPass[i]; }
+	}
+
+	void FFilterGroupOR::TestRange(const PCGExMT::FScope& Scope, TArrayView<int8> InOutMask) const
+	{
+		// Lanes that are live and haven't passed any filter yet
+		TArray<int8> Pending(InOutMask.GetData(), Scope.Count);
+		TArray<int8> Passed;
+		Passed.Init(0, Scope.Count);
+
+		TArray<int8> Lanes;
+		Lanes.SetNumUninitialized(Scope.Count);
+
+		for (const TSharedPtr<PCGExPointFilter::IFilter>& Filter : ManagedFilters)
+		{
+			FMemory::Memcpy(Lanes.GetData(), Pending.GetData(), Scope.Count);
+			Filter->TestRange(Scope, Lanes);
+
+			for (int i = 0; i < Scope.Count; i++)
+			{
+				Passed[i] |= Lanes[i];
+				Pending[i] &= !Lanes[i];
+			}
+
+			if (!PCGExPointFilter::AnyPass(Pending)) { break; } // Every lane is decided
+		}
+
+		for (int i = 0; i < Scope.Count; i++) { InOutMask[i] &= Passed[i] ^ static_cast<int8>(bInvert); }
+	}
 }
 
 #define PCGEX_FILTERGROUP_FOREACH(_BODY) for (const TObjectPtr<const UPCGExFilterFactoryData>& SubFilter : FilterFactories) { if (!IsValid(SubFilter)) { continue; } _BODY }
@@ -60,6 +60,11 @@ namespace PCGExPointFilter
 
 	bool IFilter::Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const { return bCollectionTestResult; }
 
+	void IFilter::TestRange(const PCGExMT::FScope& Scope, TArrayView<int8> InOutMask) const
+	{
+		for (int i = 0; i < Scope.Count; i++) { if (InOutMask[i]) { InOutMask[i] = Test(Scope.Start + i); } }
+	}
+
 	bool ISimpleFilter::Test(const int32 Index) const
 	PCGEX_NOT_IMPLEMENTED_RET(FSimpleFilter::Test(const PCGExCluster::FNode& Node), false)
 
@@ -84,6 +89,11 @@ namespace PCGExPointFilter
 	bool ICollectionFilter::Test(const PCGExCluster::FNode& Node) const { return bCollectionTestResult; }
 	bool ICollectionFilter::Test(const PCGExGraph::FEdge& Edge) const { return bCollectionTestResult; }
 
+	void ICollectionFilter::TestRange(const PCGExMT::FScope& Scope, TArrayView<int8> InOutMask) const
+	{
+		if (!bCollectionTestResult) { FMemory::Memzero(InOutMask.GetData(), Scope.Count); }
+	}
+
 	bool ICollectionFilter::Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const
 	PCGEX_NOT_IMPLEMENTED_RET(FCollectionFilter::Test(FPCGExContext* InContext, const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection), false)
 
@@ -151,43 +161,33 @@ namespace PCGExPointFilter
 
 	int32 FManager::Test(const PCGExMT::FScope Scope, TArray<int8>& OutResults)
 	{
-		bool bResult = true;
-		int32 NumPass = 0;
-		PCGEX_SCOPE_LOOP(Index)
-		{
-			bResult = true;
-			for (const TSharedPtr<IFilter>& Handler : ManagedFilters)
-			{
-				if (!Handler->Test(Index))
-				{
-					bResult = false;
-					break;
-				}
-			}
-			OutResults[Index] = bResult;
-			NumPass += bResult;
-		}
+		return TestRange(Scope, MakeArrayView(OutResults.GetData() + Scope.Start, Scope.Count));
+	}
+
+	int32 FManager::Test(const PCGExMT::FScope Scope, TBitArray<>& OutResults)
+	{
+		TArray<int8> Mask;
+		Mask.SetNumUninitialized(Scope.Count);
+
+		const int32 NumPass = TestRange(Scope, Mask);
+		for (int i = 0; i < Scope.Count; i++) { OutResults[Scope.Start + i] = Mask[i] != 0; }
 
 		return NumPass;
 	}
 
-	int32 FManager::Test(const PCGExMT::FScope Scope, TBitArray<>& OutResults)
+	int32 FManager::TestRange(const PCGExMT::FScope& Scope, TArrayView<int8> OutMask) const
 	{
-		bool bResult = true;
-		int32 NumPass = 0;
-		PCGEX_SCOPE_LOOP(Index)
+		FMemory::Memset(OutMask.GetData(), 1, Scope.Count);
+
+		int32 NumPass = Scope.Count;
+		for (const TSharedPtr<IFilter>& Handler : ManagedFilters)
 		{
-			bResult = true;
-			for (const TSharedPtr<IFilter>& Handler : ManagedFilters)
-			{
-				if (!Handler->Test(Index))
-				{
-					bResult = false;
-					break;
-				}
-			}
-			OutResults[Index] = bResult;
-			NumPass += bResult;
+			Handler->TestRange(Scope, OutMask);
+
+			NumPass = 0;
+			for (int i = 0; i < Scope.Count; i++) { NumPass += OutMask[i]; }
+
+			if (!NumPass) { break; } // Scope fully decided
 		}
 
 		return NumPass;
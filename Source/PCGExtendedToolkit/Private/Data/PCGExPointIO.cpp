@@ -5,6 +5,7 @@
 
 #include "PCGExContext.h"
 #include "PCGExDetails.h"
+#include "PCGExGlobalSettings.h"
 #include "PCGExMT.h"
 #include "Data/PCGExDataTag.h"
 
@@ -71,6 +72,7 @@ namespace PCGExData
 			Out = nullptr;
 		}
 
+		bInheritedOutput = false;
 		OutKeys.Reset();
 
 		bMutable = false;
@@ -116,13 +118,49 @@ namespace PCGExData
 		if (InitOut == EIOInit::Duplicate)
 		{
 			check(In)
-			Out = SharedContext.Get()->ManagedObjects->DuplicateData<UPCGBasePointData>(In);
+
+			if (CanInheritOnDuplicate(In))
+			{
+				// Copy-on-write : the output inherits the input's point properties and metadata,
+				// only the property ranges and attributes that get written to are materialized
+				UObject* GenericInstance = SharedContext.Get()->ManagedObjects->New<UObject>(GetTransientPackage(), In->GetClass());
+				Out = Cast<UPCGBasePointData>(GenericInstance);
+
+				check(Out)
+
+				FPCGInitializeFromDataParams InitializeFromDataParams(In);
+				Out->InitializeFromDataWithParams(InitializeFromDataParams);
+
+				bInheritedOutput = true;
+			}
+			else
+			{
+				Out = SharedContext.Get()->ManagedObjects->DuplicateData<UPCGBasePointData>(In);
+			}
+
 			PCGExHelpers::CopyBaseNativeProperties(In, Out);
 		}
 
 		return true;
 	}
 
+	bool FPointIO::CanInheritOnDuplicate(const UPCGBasePointData* InData)
+	{
+		// Legacy point data can't inherit
+		return GetDefault<UPCGExGlobalSettings>()->bCopyOnWriteDuplicate && InData->IsA<UPCGPointArrayData>();
+	}
+
+	void FPointIO::MaterializeOutput() const
+	{
+		if (!bInheritedOutput.load(std::memory_order_acquire)) { return; }
+
+		FWriteScopeLock WriteScopeLock(InheritedOutputLock);
+		if (!bInheritedOutput.load(std::memory_order_acquire)) { return; }
+
+		Out->Flatten();
+		bInheritedOutput.store(false, std::memory_order_release);
+	}
+
 	const UPCGBasePointData* FPointIO::GetOutIn(EIOSide& OutSide) const
 	{
 		if (Out)
@@ -289,6 +327,7 @@ namespace PCGExData
 	void FPointIO::SetPoints(const TArray<FPCGPoint>& InPCGPoints)
 	{
 		check(Out)
+		MaterializeOutput();
 		Out->SetNumPoints(InPCGPoints.Num());
 		SetPoints(0, InPCGPoints);
 	}
@@ -381,6 +420,7 @@ namespace PCGExData
 		check(Out)
 		TArray<int32> WriteIndices;
 		const int32 NumElements = PCGEx::ArrayOfIndices(WriteIndices, Mask, 0, bInvert);
+		MaterializeOutput();
 		Out->SetNumPoints(WriteIndices.Num());
 		InheritPoints(WriteIndices, 0);
 		return NumElements;
@@ -392,6 +432,7 @@ namespace PCGExData
 		check(Out)
 		TArray<int32> WriteIndices;
 		const int32 NumElements = PCGEx::ArrayOfIndices(WriteIndices, Mask, 0, bInvert);
+		MaterializeOutput();
 		Out->SetNumPoints(WriteIndices.Num());
 		InheritPoints(WriteIndices, 0);
 		return NumElements;
@@ -419,7 +460,11 @@ namespace PCGExData
 		check(Out)
 
 		const int32 NewSize = StartIndex + SelectedIndices.Num();
-		if (Out->GetNumPoints() < NewSize) { Out->SetNumPoints(NewSize); }
+		if (Out->GetNumPoints() < NewSize)
+		{
+			MaterializeOutput();
+			Out->SetNumPoints(NewSize);
+		}
 
 		TArray<int32> WriteIndices;
 		PCGEx::ArrayOfIndices(WriteIndices, SelectedIndices.Num(), StartIndex);
@@ -463,6 +508,9 @@ namespace PCGExData
 
 		if (!IsEnabled() || !Out || (!bAllowEmptyOutput && Out->IsEmpty())) { return false; }
 
+		// Staging deletes consumable attributes straight from the output metadata
+		if (bMutable && TargetContext->bCleanupConsumableAttributes && !TargetContext->GetConsumableAttributesSet().IsEmpty()) { MaterializeOutput(); }
+
 		TargetContext->StageOutput(Out, OutputPin, Tags->Flatten(), Out != In, bMutable, bPinless);
 
 		return true;
@@ -517,6 +565,8 @@ namespace PCGExData
 
 		if (ReducedNum == Out->GetNumPoints()) { return ReducedNum; }
 
+		MaterializeOutput();
+
 		PCGEX_FOREACH_POINT_NATIVE_PROPERTY_GET(Out)
 
 		Out->AllocateProperties(EPCGPointNativeProperties::All);
@@ -558,6 +608,8 @@ namespace PCGExData
 	{
 		if (!Out) { return; }
 
+		MaterializeOutput();
+
 		{
 			FWriteScopeLock WriteScopeLock(AttributesLock);
 			if (PCGEx::HasAttribute(Out->Metadata, Identifier)) { Out->Metadata->DeleteAttribute(Identifier); }
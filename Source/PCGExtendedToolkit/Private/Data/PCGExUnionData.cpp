@@ -5,11 +5,40 @@
 
 #include "PCGExPointsMT.h"
 #include "Data/PCGExData.h"
+#include "Async/ParallelFor.h"
 
 namespace PCGExData
 {
 #pragma region Union Data
 
+	int32 FinalizeUnionWeights(TArray<FWeightedPoint>& InOutWeightedPoints, const double MaxWeight)
+	{
+		const int32 Num = InOutWeightedPoints.Num();
+		if (Num == 0) { return 0; }
+
+		double TotalWeight = 0;
+
+		// Normalize & one minus distances to make them weights
+		for (FWeightedPoint& P : InOutWeightedPoints) { TotalWeight += (P.Weight = 1 - (P.Weight / MaxWeight)); }
+
+		if (Num == 1)
+		{
+			InOutWeightedPoints[0].Weight = 1;
+			return 1;
+		}
+
+		if (TotalWeight == 0)
+		{
+			const double StaticWeight = 1 / static_cast<double>(Num);
+			for (FWeightedPoint& P : InOutWeightedPoints) { P.Weight = StaticWeight; }
+			return Num;
+		}
+
+		// Normalize weights
+		//for (FWeightedPoint& P : InOutWeightedPoints) { P.Weight /= TotalWeight; }
+		return Num;
+	}
+
 	int32 IUnionData::ComputeWeights(
 		const TArray<const UPCGBasePointData*>& Sources, const TSharedPtr<PCGEx::FIndexLookup>& IdxLookup, const FConstPoint& Target,
 		const TSharedPtr<PCGExDetails::FDistances>& InDistanceDetails, TArray<FWeightedPoint>& OutWeightedPoints) const
@@ -18,7 +47,6 @@ namespace PCGExData
 		OutWeightedPoints.Reset(NumElements);
 
 		double MaxWeight = 0;
-		double TotalWeight = 0;
 		int32 Index = 0;
 
 		for (const FElement& Element : Elements)
@@ -36,25 +64,7 @@ namespace PCGExData
 
 		if (Index == 0) { return 0; }
 
-		// Normalize & one minus distances to make them weights
-		for (FWeightedPoint& P : OutWeightedPoints) { TotalWeight += (P.Weight = 1 - (P.Weight / MaxWeight)); }
-
-		if (Index == 1)
-		{
-			OutWeightedPoints[0].Weight = 1;
-			return 1;
-		}
-
-		if (TotalWeight == 0)
-		{
-			const double StaticWeight = 1 / static_cast<double>(Index);
-			for (FWeightedPoint& P : OutWeightedPoints) { P.Weight = StaticWeight; }
-			return Index;
-		}
-
-		// Normalize weights
-		//for (FWeightedPoint& P : OutWeightedPoints) { P.Weight /= TotalWeight; }
-		return Index;
+		return FinalizeUnionWeights(OutWeightedPoints, MaxWeight);
 	}
 
 
@@ -104,6 +114,27 @@ namespace PCGExData
 		return Entries[ItemIndex];
 	}
 
+	void FUnionMetadata::Flatten()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FUnionMetadata::Flatten);
+
+		const int32 NumEntries = Entries.Num();
+
+		// Counting pass
+		FlatOffsets.SetNumUninitialized(NumEntries + 1);
+		FlatOffsets[0] = 0;
+		for (int32 i = 0; i < NumEntries; i++) { FlatOffsets[i + 1] = FlatOffsets[i] + Entries[i]->Elements.Num(); }
+
+		FlatElements.SetNumUninitialized(FlatOffsets[NumEntries]);
+
+		ParallelFor(
+			NumEntries, [&](const int32 i)
+			{
+				const TArray<FElement, TInlineAllocator<8>>& Elements = Entries[i]->Elements;
+				FMemory::Memcpy(FlatElements.GetData() + FlatOffsets[i], Elements.GetData(), Elements.Num() * sizeof(FElement));
+			}, NumEntries < 4096 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+	}
+
 	void FUnionMetadata::Append(const int32 Index, const FPoint& Point)
 	{
 		Entries[Index]->Add(Point);
@@ -0,0 +1,163 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Graph/Data/PCGExClusterCache.h"
+
+#include "Hash/xxhash.h"
+#include "Misc/Crc.h"
+
+namespace PCGExClusterCache
+{
+	namespace
+	{
+		static_assert(sizeof(FHeader) % 4 == 0, "Sections must stay 4-bytes aligned");
+		static_assert(sizeof(PCGExGraph::FLink) == 2 * sizeof(int32), "FLink is serialized as raw memory");
+
+		FORCEINLINE int64 GetPayloadSize(const int32 NumNodes, const int32 NumLinks, const int32 NumEdges)
+		{
+			return static_cast<int64>(NumNodes) * sizeof(uint32)
+				+ static_cast<int64>(NumNodes + 1) * sizeof(int32)
+				+ static_cast<int64>(NumLinks) * sizeof(PCGExGraph::FLink)
+				+ static_cast<int64>(NumEdges) * 2 * sizeof(int32);
+		}
+	}
+
+	uint64 ComputeContentHash(TConstArrayView<int64> InEdgeEndpoints)
+	{
+		return FXxHash64::HashBuffer(InEdgeEndpoints.GetData(), InEdgeEndpoints.Num() * sizeof(int64)).Hash;
+	}
+
+	bool Write(TConstArrayView<int64> InEdgeEndpoints, TArray<uint8>& OutBlob)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClusterCache::Write);
+
+		OutBlob.Reset();
+
+		const int32 NumEdges = InEdgeEndpoints.Num();
+		if (!NumEdges) { return false; }
+
+		// Nodes are created on first appearance while walking edges, same as FCluster::BuildFrom
+		TMap<uint32, int32> NodeLookup;
+		NodeLookup.Reserve(NumEdges);
+
+		TArray<uint32> NodeVtxIds;
+		TArray<int32> Degrees;
+		TArray<int32> EdgeNodes;
+
+		NodeVtxIds.Reserve(NumEdges);
+		Degrees.Reserve(NumEdges);
+		EdgeNodes.SetNumUninitialized(NumEdges * 2);
+
+		auto GetOrCreateNode = [&](const uint32 VtxId)
+		{
+			if (const int32* Existing = NodeLookup.Find(VtxId)) { return *Existing; }
+			const int32 NodeIndex = NodeVtxIds.Add(VtxId);
+			Degrees.Add(0);
+			NodeLookup.Add(VtxId, NodeIndex);
+			return NodeIndex;
+		};
+
+		for (int32 i = 0; i < NumEdges; i++)
+		{
+			uint32 A;
+			uint32 B;
+			PCGEx::H64(InEdgeEndpoints[i], A, B);
+
+			if (A == B) { return false; }
+
+			const int32 StartNode = GetOrCreateNode(A);
+			const int32 EndNode = GetOrCreateNode(B);
+
+			EdgeNodes[i * 2] = StartNode;
+			EdgeNodes[i * 2 + 1] = EndNode;
+
+			Degrees[StartNode]++;
+			Degrees[EndNode]++;
+		}
+
+		const int32 NumNodes = NodeVtxIds.Num();
+		const int32 NumLinks = NumEdges * 2;
+
+		FHeader Header;
+		Header.Magic = Magic;
+		Header.Version = Version;
+		Header.ContentHash = ComputeContentHash(InEdgeEndpoints);
+		Header.NumEdges = NumEdges;
+		Header.NumNodes = NumNodes;
+		Header.NumLinks = NumLinks;
+
+		OutBlob.SetNumUninitialized(sizeof(FHeader) + GetPayloadSize(NumNodes, NumLinks, NumEdges));
+
+		uint8* Payload = OutBlob.GetData() + sizeof(FHeader);
+		uint8* Cursor = Payload;
+
+		FMemory::Memcpy(Cursor, NodeVtxIds.GetData(), NumNodes * sizeof(uint32));
+		Cursor += NumNodes * sizeof(uint32);
+
+		int32* LinkOffsets = reinterpret_cast<int32*>(Cursor);
+		LinkOffsets[0] = 0;
+		for (int32 i = 0; i < NumNodes; i++) { LinkOffsets[i + 1] = LinkOffsets[i] + Degrees[i]; }
+		Cursor += (NumNodes + 1) * sizeof(int32);
+
+		// Links are appended in edge order, start then end, matching FNode::Link calls in BuildFrom
+		PCGExGraph::FLink* Links = reinterpret_cast<PCGExGraph::FLink*>(Cursor);
+		TArray<int32> WriteHeads;
+		WriteHeads.SetNumUninitialized(NumNodes);
+		FMemory::Memcpy(WriteHeads.GetData(), LinkOffsets, NumNodes * sizeof(int32));
+
+		for (int32 i = 0; i < NumEdges; i++)
+		{
+			const int32 StartNode = EdgeNodes[i * 2];
+			const int32 EndNode = EdgeNodes[i * 2 + 1];
+			Links[WriteHeads[StartNode]++] = PCGExGraph::FLink(EndNode, i);
+			Links[WriteHeads[EndNode]++] = PCGExGraph::FLink(StartNode, i);
+		}
+		Cursor += NumLinks * sizeof(PCGExGraph::FLink);
+
+		FMemory::Memcpy(Cursor, EdgeNodes.GetData(), NumEdges * 2 * sizeof(int32));
+
+		Header.PayloadCrc = FCrc::MemCrc32(Payload, OutBlob.Num() - sizeof(FHeader));
+		FMemory::Memcpy(OutBlob.GetData(), &Header, sizeof(FHeader));
+
+		return true;
+	}
+
+	bool Read(TConstArrayView<uint8> InBlob, TConstArrayView<int64> InEdgeEndpoints, FView& OutView)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClusterCache::Read);
+
+		if (InBlob.Num() < sizeof(FHeader)) { return false; }
+
+		FHeader Header;
+		FMemory::Memcpy(&Header, InBlob.GetData(), sizeof(FHeader));
+
+		if (Header.Magic != Magic || Header.Version != Version) { return false; }
+		if (Header.NumEdges != InEdgeEndpoints.Num() || Header.NumNodes <= 0 || Header.NumLinks != Header.NumEdges * 2) { return false; }
+		if (InBlob.Num() != sizeof(FHeader) + GetPayloadSize(Header.NumNodes, Header.NumLinks, Header.NumEdges)) { return false; }
+
+		const uint8* Payload = InBlob.GetData() + sizeof(FHeader);
+		if (FCrc::MemCrc32(Payload, InBlob.Num() - sizeof(FHeader)) != Header.PayloadCrc) { return false; }
+		if (ComputeContentHash(InEdgeEndpoints) != Header.ContentHash) { return false; }
+
+		const uint8* Cursor = Payload;
+
+		OutView.NodeVtxIds = MakeArrayView(reinterpret_cast<const uint32*>(Cursor), Header.NumNodes);
+		Cursor += Header.NumNodes * sizeof(uint32);
+
+		OutView.LinkOffsets = MakeArrayView(reinterpret_cast<const int32*>(Cursor), Header.NumNodes + 1);
+		Cursor += (Header.NumNodes + 1) * sizeof(int32);
+
+		OutView.Links = MakeArrayView(reinterpret_cast<const PCGExGraph::FLink*>(Cursor), Header.NumLinks);
+		Cursor += Header.NumLinks * sizeof(PCGExGraph::FLink);
+
+		OutView.EdgeNodes = MakeArrayView(reinterpret_cast<const int32*>(Cursor), Header.NumEdges * 2);
+
+		// The checksum catches corruption, not a crafted blob; keep indices in range regardless
+		if (OutView.LinkOffsets[0] != 0 || OutView.LinkOffsets[Header.NumNodes] != Header.NumLinks) { return false; }
+		for (int32 i = 0; i < Header.NumNodes; i++) { if (OutView.LinkOffsets[i + 1] < OutView.LinkOffsets[i]) { return false; } }
+		for (const int32 NodeIndex : OutView.EdgeNodes) { if (NodeIndex < 0 || NodeIndex >= Header.NumNodes) { return false; } }
+		for (const PCGExGraph::FLink& Lk : OutView.Links) { if (Lk.Node < 0 || Lk.Node >= Header.NumNodes || Lk.Edge < 0 || Lk.Edge >= Header.NumEdges) { return false; } }
+
+		return true;
+	}
+}
@@ -7,6 +7,8 @@
 #include "Data/PCGExPointIO.h"
 #include "PCGExGlobalSettings.h"
 #include "Graph/PCGExCluster.h"
+#include "Graph/Data/PCGExClusterCache.h"
+#include "UObject/ObjectSaveContext.h"
 
 UPCGSpatialData* UPCGExClusterNodesData::CopyInternal(FPCGContext* Context) const
 {
@@ -40,6 +42,26 @@ const TSharedPtr<PCGExCluster::FCluster>& UPCGExClusterEdgesData::GetBoundCluste
 	return Cluster;
 }
 
+void UPCGExClusterEdgesData::PreSave(FObjectPreSaveContext SaveContext)
+{
+	Super::PreSave(SaveContext);
+
+	ClusterCache.Empty();
+
+	if (!GetDefault<UPCGExGlobalSettings>()->bPersistClusterCache) { return; }
+
+	const FPCGMetadataAttribute<int64>* EndpointsAttribute = PCGEx::TryGetConstAttribute<int64>(ConstMetadata(), PCGExGraph::Attr_PCGExEdgeIdx);
+	if (!EndpointsAttribute) { return; }
+
+	const TConstPCGValueRange<int64> MetadataEntries = GetConstMetadataEntryValueRange();
+
+	TArray<int64> Endpoints;
+	Endpoints.SetNumUninitialized(MetadataEntries.Num());
+	for (int i = 0; i < Endpoints.Num(); i++) { Endpoints[i] = EndpointsAttribute->GetValueFromItemKey(MetadataEntries[i]); }
+
+	PCGExClusterCache::Write(Endpoints, ClusterCache);
+}
+
 void UPCGExClusterEdgesData::BeginDestroy()
 {
 	Super::BeginDestroy();
@@ -0,0 +1,122 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Graph/Edges/Relaxing/PCGExFittingRelaxRepulsion.h"
+
+#include <algorithm>
+
+namespace PCGExFittingRelax
+{
+	void FRepulsionGrid::Build(const TArray<FVector>& InCenters, const double InCellSize)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExFittingRelax::FRepulsionGrid::Build);
+
+		const int32 NumItems = InCenters.Num();
+		InvCellSize = 1.0 / FMath::Max(InCellSize, 1.0); // Keep cell coordinates within int32 range
+
+		CellIndices.Reset();
+		CellStarts.Reset();
+		ItemCells.SetNumUninitialized(NumItems);
+		Items.SetNumUninitialized(NumItems);
+
+		// Two passes : count items per cell, then scatter into a flat array
+
+		TArray<int32> ItemCellIndices;
+		ItemCellIndices.SetNumUninitialized(NumItems);
+
+		TArray<int32> Counts;
+		Counts.Reserve(NumItems);
+
+		for (int32 i = 0; i < NumItems; i++)
+		{
+			const FVector P = InCenters[i] * InvCellSize;
+			const FIntVector Cell = FIntVector(FMath::FloorToInt32(P.X), FMath::FloorToInt32(P.Y), FMath::FloorToInt32(P.Z));
+			ItemCells[i] = Cell;
+
+			int32& CellIndex = CellIndices.FindOrAdd(Cell, -1);
+			if (CellIndex == -1) { CellIndex = Counts.Add(0); }
+
+			Counts[CellIndex]++;
+			ItemCellIndices[i] = CellIndex;
+		}
+
+		const int32 NumCells = Counts.Num();
+		CellStarts.SetNumUninitialized(NumCells + 1);
+		CellStarts[0] = 0;
+		for (int32 i = 0; i < NumCells; i++) { CellStarts[i + 1] = CellStarts[i] + Counts[i]; }
+
+		// Reuse counts as write cursors
+		for (int32 i = 0; i < NumCells; i++) { Counts[i] = CellStarts[i]; }
+		for (int32 i = 0; i < NumItems; i++) { Items[Counts[ItemCellIndices[i]]++] = i; }
+	}
+
+	void FRepulsionTree::Build(const TArray<FVector>& InCenters, const TArray<FVector>& InExtents)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExFittingRelax::FRepulsionTree::Build);
+
+		Centers = &InCenters;
+		Extents = &InExtents;
+
+		Nodes.Reset();
+
+		const int32 NumItems = InCenters.Num();
+		Items.SetNumUninitialized(NumItems);
+		for (int32 i = 0; i < NumItems; i++) { Items[i] = i; }
+
+		if (!NumItems) { return; }
+
+		Nodes.Reserve(2 * FMath::DivideAndRoundUp(NumItems, MaxItemsPerLeaf));
+		BuildRecursive(0, NumItems);
+	}
+
+	int32 FRepulsionTree::BuildRecursive(const int32 Start, const int32 End)
+	{
+		const int32 NodeIndex = Nodes.Emplace();
+
+		FBox Bounds = FBox(ForceInit);
+		FVector Center = FVector::ZeroVector;
+		FVector MeanExtent = FVector::ZeroVector;
+		double MaxReach = 0;
+
+		for (int32 i = Start; i < End; i++)
+		{
+			const FVector& P = (*Centers)[Items[i]];
+			const FVector& E = (*Extents)[Items[i]];
+			Bounds += P;
+			Center += P;
+			MeanExtent += E;
+			MaxReach = FMath::Max(MaxReach, E.GetMax());
+		}
+
+		const double Count = End - Start;
+
+		FNode& Node = Nodes[NodeIndex];
+		Node.Bounds = Bounds;
+		Node.Center = Center / Count;
+		Node.MeanExtent = MeanExtent / Count;
+		Node.MaxReach = MaxReach;
+		Node.Start = Start;
+		Node.End = End;
+
+		if (End - Start <= MaxItemsPerLeaf) { return NodeIndex; }
+
+		const FVector Size = Bounds.GetSize();
+		const int32 Axis = Size.X >= Size.Y ? (Size.X >= Size.Z ? 0 : 2) : (Size.Y >= Size.Z ? 1 : 2);
+		const int32 Mid = Start + (End - Start) / 2;
+
+		const TArray<FVector>& CentersRef = *Centers;
+		int32* Data = Items.GetData();
+		std::nth_element(
+			Data + Start, Data + Mid, Data + End,
+			[&CentersRef, Axis](const int32 A, const int32 B) { return CentersRef[A][Axis] < CentersRef[B][Axis]; });
+
+		// Recursion may reallocate Nodes; don't hold references across it
+		const int32 Left = BuildRecursive(Start, Mid);
+		const int32 Right = BuildRecursive(Mid, End);
+
+		Nodes[NodeIndex].Left = Left;
+		Nodes[NodeIndex].Right = Right;
+
+		return NodeIndex;
+	}
+}
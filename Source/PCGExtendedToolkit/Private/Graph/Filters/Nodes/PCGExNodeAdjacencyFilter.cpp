@@ -59,7 +59,7 @@ bool FNodeAdjacencyFilter::Init(FPCGExContext* InContext, const TSharedRef<PCGEx
 				PCGEX_SUB_TEST_FUNC
 				{
 					double B = 0;
-					for (const PCGExGraph::FLink Lk : Node.Links)
+					for (const PCGExGraph::FLink Lk : Cluster->GetLinks(Node.Index))
 					{
 						B = OperandB->Read(NodesRef[Lk.Node].PointIndex);
 						if (!PCGExCompare::Compare(TypedFilterFactory->Config.Comparison, A, B, TypedFilterFactory->Config.Tolerance)) { return false; }
@@ -72,7 +72,7 @@ bool FNodeAdjacencyFilter::Init(FPCGExContext* InContext, const TSharedRef<PCGEx
 				PCGEX_SUB_TEST_FUNC
 				{
 					double B = 0;
-					for (const PCGExGraph::FLink Lk : Node.Links)
+					for (const PCGExGraph::FLink Lk : Cluster->GetLinks(Node.Index))
 					{
 						B = OperandB->Read(Lk.Edge);
 						if (!PCGExCompare::Compare(TypedFilterFactory->Config.Comparison, A, B, TypedFilterFactory->Config.Tolerance)) { return false; }
@@ -91,7 +91,7 @@ bool FNodeAdjacencyFilter::Init(FPCGExContext* InContext, const TSharedRef<PCGEx
 				PCGEX_SUB_TEST_FUNC
 				{
 					double B = 0;
-					for (const PCGExGraph::FLink Lk : Node.Links) { B += OperandB->Read(NodesRef[Lk.Node].PointIndex); }
+					for (const PCGExGraph::FLink Lk : Cluster->GetLinks(Node.Index)) { B += OperandB->Read(NodesRef[Lk.Node].PointIndex); }
 					return PCGExCompare::Compare(TypedFilterFactory->Config.Comparison, A, B, TypedFilterFactory->Config.Tolerance);
 				};
 			}
@@ -100,7 +100,7 @@ bool FNodeAdjacencyFilter::Init(FPCGExContext* InContext, const TSharedRef<PCGEx
 				PCGEX_SUB_TEST_FUNC
 				{
 					double B = 0;
-					for (const PCGExGraph::FLink Lk : Node.Links) { B += OperandB->Read(Lk.Edge); }
+					for (const PCGExGraph::FLink Lk : Cluster->GetLinks(Node.Index)) { B += OperandB->Read(Lk.Edge); }
 					return PCGExCompare::Compare(TypedFilterFactory->Config.Comparison, A, B, TypedFilterFactory->Config.Tolerance);
 				};
 			}
@@ -112,7 +112,7 @@ bool FNodeAdjacencyFilter::Init(FPCGExContext* InContext, const TSharedRef<PCGEx
 				PCGEX_SUB_TEST_FUNC
 				{
 					double B = MAX_dbl;
-					for (const PCGExGraph::FLink Lk : Node.Links) { B = FMath::Min(B, OperandB->Read(NodesRef[Lk.Node].PointIndex)); }
+					for (const PCGExGraph::FLink Lk : Cluster->GetLinks(Node.Index)) { B = FMath::Min(B, OperandB->Read(NodesRef[Lk.Node].PointIndex)); }
 					return PCGExCompare::Compare(TypedFilterFactory->Config.Comparison, A, B, TypedFilterFactory->Config.Tolerance);
 				};
 			}
@@ -121,7 +121,7 @@ bool FNodeAdjacencyFilter::Init(FPCGExContext* InContext, const TSharedRef<PCGEx
 				PCGEX_SUB_TEST_FUNC
 				{
 					double B = MAX_dbl;
-					for (const PCGExGraph::FLink Lk : Node.Links) { B = FMath::Min(B, OperandB->Read(Lk.Edge)); }
+					for (const PCGExGraph::FLink Lk : Cluster->GetLinks(Node.Index)) { B = FMath::Min(B, OperandB->Read(Lk.Edge)); }
 					return PCGExCompare::Compare(TypedFilterFactory->Config.Comparison, A, B, TypedFilterFactory->Config.Tolerance);
 				};
 			}
@@ -132,7 +132,7 @@ bool FNodeAdjacencyFilter::Init(FPCGExContext* InContext, const TSharedRef<PCGEx
 				PCGEX_SUB_TEST_FUNC
 				{
 					double B = MIN_dbl_neg;
-					for (const PCGExGraph::FLink Lk : Node.Links) { B = FMath::Max(B, OperandB->Read(NodesRef[Lk.Node].PointIndex)); }
+					for (const PCGExGraph::FLink Lk : Cluster->GetLinks(Node.Index)) { B = FMath::Max(B, OperandB->Read(NodesRef[Lk.Node].PointIndex)); }
 					return PCGExCompare::Compare(TypedFilterFactory->Config.Comparison, A, B, TypedFilterFactory->Config.Tolerance);
 				};
 			}
@@ -141,7 +141,7 @@ bool FNodeAdjacencyFilter::Init(FPCGExContext* InContext, const TSharedRef<PCGEx
 				PCGEX_SUB_TEST_FUNC
 				{
 					double B = MIN_dbl_neg;
-					for (const PCGExGraph::FLink Lk : Node.Links) { B = FMath::Max(B, OperandB->Read(Lk.Edge)); }
+					for (const PCGExGraph::FLink Lk : Cluster->GetLinks(Node.Index)) { B = FMath::Max(B, OperandB->Read(Lk.Edge)); }
 					return PCGExCompare::Compare(TypedFilterFactory->Config.Comparison, A, B, TypedFilterFactory->Config.Tolerance);
 				};
 			}
@@ -152,7 +152,7 @@ bool FNodeAdjacencyFilter::Init(FPCGExContext* InContext, const TSharedRef<PCGEx
 				PCGEX_SUB_TEST_FUNC
 				{
 					double B = MIN_dbl_neg;
-					for (const PCGExGraph::FLink Lk : Node.Links) { B += FMath::Max(B, OperandB->Read(NodesRef[Lk.Node].PointIndex)); }
+					for (const PCGExGraph::FLink Lk : Cluster->GetLinks(Node.Index)) { B += FMath::Max(B, OperandB->Read(NodesRef[Lk.Node].PointIndex)); }
 					return PCGExCompare::Compare(TypedFilterFactory->Config.Comparison, A, B, TypedFilterFactory->Config.Tolerance);
 				};
 			}
@@ -161,7 +161,7 @@ bool FNodeAdjacencyFilter::Init(FPCGExContext* InContext, const TSharedRef<PCGEx
 				PCGEX_SUB_TEST_FUNC
 				{
 					double B = MIN_dbl_neg;
-					for (const PCGExGraph::FLink Lk : Node.Links) { B += FMath::Max(B, OperandB->Read(Lk.Edge)); }
+					for (const PCGExGraph::FLink Lk : Cluster->GetLinks(Node.Index)) { B += FMath::Max(B, OperandB->Read(Lk.Edge)); }
 					return PCGExCompare::Compare(TypedFilterFactory->Config.Comparison, A, B, TypedFilterFactory->Config.Tolerance);
 				};
 			}
@@ -184,7 +184,7 @@ bool FNodeAdjacencyFilter::Init(FPCGExContext* InContext, const TSharedRef<PCGEx
 			int32 LocalSuccessCount = 0;
 			double B = 0;
 
-			for (const PCGExGraph::FLink Lk : Node.Links)
+			for (const PCGExGraph::FLink Lk : Cluster->GetLinks(Node.Index))
 			{
 				B = OperandB->Read(NodesRef[Lk.Node].PointIndex);
 				if (PCGExCompare::Compare(TypedFilterFactory->Config.Comparison, A, B, TypedFilterFactory->Config.Tolerance)) { LocalSuccessCount++; }
@@ -203,7 +203,7 @@ bool FNodeAdjacencyFilter::Init(FPCGExContext* InContext, const TSharedRef<PCGEx
 			int32 LocalSuccessCount = 0;
 			double B = 0;
 
-			for (const PCGExGraph::FLink Lk : Node.Links)
+			for (const PCGExGraph::FLink Lk : Cluster->GetLinks(Node.Index))
 			{
 				B = OperandB->Read(Lk.Edge);
 				if (PCGExCompare::Compare(TypedFilterFactory->Config.Comparison, A, B, TypedFilterFactory->Config.Tolerance)) { LocalSuccessCount++; }
@@ -27,7 +27,10 @@ namespace PCGExFloodFill
 	{
 		SeedIndex = InSeedIndex;
 
-		Visited.Add(SeedNode->Index);
+		Visited.Init(false, Cluster->Nodes->Num());
+		Visited[SeedNode->Index] = true;
+		Endpoints.Add(false);
+
 		*(FillControlsHandler->InfluencesCount->GetData() + SeedNode->PointIndex) = 1;
 		FCandidate& SeedCandidate = Captured.Emplace_GetRef();
 		SeedCandidate.Link = PCGExGraph::FLink(-1, -1);
@@ -45,8 +48,8 @@ namespace PCGExFloodFill
 			return;
 		}
 
-		// Gather all neighbors and compute heuristics, add to candidate for the first time only
-		bool bIsAlreadyInSet = false;
+		// Gather all neighbors and compute heuristics.
+		// Neighbors are added to candidates the first time they're seen, and updated if a better path is found while they're still in the frontier.
 
 		TSharedPtr<PCGExHeuristics::FHeuristicsHandler> HeuristicsHandler = FillControlsHandler->HeuristicsHandler.Pin();
 		if (!HeuristicsHandler) { return; }
@@ -56,12 +59,16 @@ namespace PCGExFloodFill
 
 		FVector FromPosition = Cluster->GetPos(FromNode);
 
-		for (const PCGExGraph::FLink& Lk : FromNode.Links)
+		for (const PCGExGraph::FLink& Lk : Cluster->GetLinks(FromNode.Index))
 		{
 			PCGExCluster::FNode* OtherNode = Cluster->GetNode(Lk);
-			Visited.Add(OtherNode->Index, &bIsAlreadyInSet);
 
-			if (bIsAlreadyInSet) { continue; }
+			const int32* HeapIndex = nullptr;
+			if (Visited[OtherNode->Index])
+			{
+				HeapIndex = HeapIndices.Find(OtherNode->Index);
+				if (!HeapIndex) { continue; } // Captured or discarded
+			}
 
 			FVector OtherPosition = Cluster->GetPos(OtherNode);
 			double Dist = FVector::Dist(FromPosition, OtherPosition);
@@ -97,10 +104,24 @@ namespace PCGExFloodFill
 			Candidate.Distance = Dist;
 			Candidate.PathDistance = From.PathDistance + Dist;
 
+			if (HeapIndex)
+			{
+				// Decrease-key, when a better path to a frontier node shows up
+				if (IsBetterCandidate(Candidate, Candidates[*HeapIndex]) &&
+					FillControlsHandler->IsValidCandidate(this, From, Candidate))
+				{
+					UpdateCandidate(*HeapIndex, Candidate);
+				}
+
+				continue;
+			}
+
+			Visited[OtherNode->Index] = true;
+
 			if (FillControlsHandler->IsValidCandidate(this, From, Candidate))
 			{
 				// Valid candidate
-				Candidates.Add(Candidate);
+				PushCandidate(Candidate);
 			}
 		}
 	}
@@ -114,11 +135,13 @@ namespace PCGExFloodFill
 		{
 			if (Candidates.IsEmpty())
 			{
+				// Seeds are all initialized up-front, don't hold on to the frontier until write time
 				bStopped = true;
+				ReleaseFrontier();
 				break;
 			}
 
-			FCandidate Candidate = Candidates.Pop(EAllowShrinking::No);
+			FCandidate Candidate = PopCandidate();
 
 			if (!FillControlsHandler->TryCapture(this, Candidate)) { continue; }
 
@@ -131,8 +154,8 @@ namespace PCGExFloodFill
 
 			TravelStack->Set(Candidate.Node->Index, PCGEx::NH64(Candidate.Link.Node, Candidate.Link.Edge));
 
-			Endpoints.Add(CapturedCandidate.CaptureIndex);
-			Endpoints.Remove(Candidate.CaptureIndex);
+			Endpoints.Add(true);
+			Endpoints[Candidate.CaptureIndex] = false;
 
 			PostGrow();
 
@@ -143,30 +166,94 @@ namespace PCGExFloodFill
 	void FDiffusion::PostGrow()
 	{
 		// Probe from last captured candidate
+		// Candidates are kept in a heap so there is no need to sort them afterward
 
 		Probe(Captured.Last());
+	}
 
-		// Sort candidates
-
+	bool FDiffusion::IsBetterCandidate(const FCandidate& A, const FCandidate& B) const
+	{
 		switch (FillControlsHandler->Sorting)
 		{
+		default:
 		case EPCGExFloodFillPrioritization::Heuristics:
-			Candidates.Sort(
-				[&](const FCandidate& A, const FCandidate& B)
-				{
-					if (A.Score == B.Score) { return A.Depth > B.Depth; }
-					return A.Score > B.Score;
-				});
-			break;
+			if (A.Score == B.Score) { return A.Depth < B.Depth; }
+			return A.Score < B.Score;
 		case EPCGExFloodFillPrioritization::Depth:
-			Candidates.Sort(
-				[&](const FCandidate& A, const FCandidate& B)
-				{
-					if (A.Depth == B.Depth) { return A.Score > B.Score; }
-					return A.Depth > B.Depth;
-				});
-			break;
+			if (A.Depth == B.Depth) { return A.Score < B.Score; }
+			return A.Depth < B.Depth;
+		}
+	}
+
+	void FDiffusion::PushCandidate(const FCandidate& Candidate)
+	{
+		const int32 HeapIndex = Candidates.Add(Candidate);
+		HeapIndices.Add(Candidate.Node->Index, HeapIndex);
+		SiftUp(HeapIndex);
+	}
+
+	void FDiffusion::UpdateCandidate(const int32 HeapIndex, const FCandidate& Candidate)
+	{
+		// Only ever called with a better candidate, so it can only move up
+		Candidates[HeapIndex] = Candidate;
+		SiftUp(HeapIndex);
+	}
+
+	FCandidate FDiffusion::PopCandidate()
+	{
+		FCandidate Best = Candidates[0];
+		HeapIndices.Remove(Best.Node->Index);
+
+		const FCandidate Last = Candidates.Pop(EAllowShrinking::No);
+		if (!Candidates.IsEmpty())
+		{
+			PlaceCandidate(0, Last);
+			SiftDown(0);
+		}
+
+		return Best;
+	}
+
+	void FDiffusion::SiftUp(int32 HeapIndex)
+	{
+		const FCandidate Candidate = Candidates[HeapIndex];
+
+		while (HeapIndex > 0)
+		{
+			const int32 Parent = (HeapIndex - 1) / 4;
+			if (!IsBetterCandidate(Candidate, Candidates[Parent])) { break; }
+
+			PlaceCandidate(HeapIndex, Candidates[Parent]);
+			HeapIndex = Parent;
+		}
+
+		PlaceCandidate(HeapIndex, Candidate);
+	}
+
+	void FDiffusion::SiftDown(int32 HeapIndex)
+	{
+		const FCandidate Candidate = Candidates[HeapIndex];
+		const int32 Num = Candidates.Num();
+
+		while (true)
+		{
+			const int32 FirstChild = HeapIndex * 4 + 1;
+			if (FirstChild >= Num) { break; }
+
+			int32 BestChild = FirstChild;
+			const int32 LastChild = FMath::Min(FirstChild + 4, Num);
+			for (int32 Child = FirstChild + 1; Child < LastChild; Child++)
+			{
+				if (IsBetterCandidate(Candidates[Child], Candidates[BestChild])) { BestChild = Child; }
+			}
+
+			if (!IsBetterCandidate(Candidates[BestChild], Candidate)) { break; }
+
+			PlaceCandidate(HeapIndex, Candidates[BestChild]);
+			HeapIndex = BestChild;
 		}
+
+		PlaceCandidate(HeapIndex, Candidate);
 	}
 
 	void FDiffusion::Diffuse(
@@ -316,7 +316,7 @@ namespace PCGExClusterDiffusion
 
 		// Diffuse & blend
 		Diffusion->Diffuse(VtxDataFacade, BlendOpsManager, Indices);
-		FPlatformAtomics::InterlockedAdd(&ExpectedPathCount, Diffusion->Endpoints.Num());
+		FPlatformAtomics::InterlockedAdd(&ExpectedPathCount, Diffusion->GetNumEndpoints());
 		FPlatformAtomics::InterlockedAdd(&Context->ExpectedPathCount, ExpectedPathCount);
 
 		// Outputs
@@ -330,7 +330,7 @@ namespace PCGExClusterDiffusion
 				PCGEX_OUTPUT_VALUE(DiffusionDepth, TargetIndex, Candidate.Depth);
 				PCGEX_OUTPUT_VALUE(DiffusionDistance, TargetIndex, Candidate.PathDistance);
 				PCGEX_OUTPUT_VALUE(DiffusionOrder, TargetIndex, i);
-				PCGEX_OUTPUT_VALUE(DiffusionEnding, TargetIndex, Diffusion->Endpoints.Contains(Candidate.CaptureIndex));
+				PCGEX_OUTPUT_VALUE(DiffusionEnding, TargetIndex, Diffusion->IsEndpoint(Candidate.CaptureIndex));
 			}
 
 			// Forward seed values to diffusion
@@ -338,7 +338,7 @@ namespace PCGExClusterDiffusion
 		}
 
 		// Diffusion->Captured.Empty(); // We need it for paths, TODO : turn diff data into shared vtx arrays on the batch instead.
-		Diffusion->Candidates.Empty();
+		Diffusion->ReleaseFrontier();
 
 		// TODO : Cleanup the diffusion if we don't want paths
 	}
@@ -360,7 +360,7 @@ namespace PCGExClusterDiffusion
 				{
 					PCGEX_ASYNC_THIS
 					TSharedPtr<PCGExFloodFill::FDiffusion> Diff = This->Diffusions[Index];
-					for (const int32 EndpointIndex : Diff->Endpoints) { This->WriteFullPath(Index, Diff->Captured[EndpointIndex].Node->Index); }
+					for (TConstSetBitIterator<> It(Diff->Endpoints); It; ++It) { This->WriteFullPath(Index, Diff->Captured[It.GetIndex()].Node->Index); }
 				};
 
 			PathsTaskGroup->StartIterations(Diffusions.Num(), 1);
@@ -381,7 +381,9 @@ namespace PCGExClusterDiffusion
 				TArray<int32> PathIndices;
 				PathIndices.Reserve(Captured.Num());
 
-				TArray<int32> Endpoints = Diff->Endpoints.Array();
+				TArray<int32> Endpoints;
+				Endpoints.Reserve(Diff->GetNumEndpoints());
+				for (TConstSetBitIterator<> It(Diff->Endpoints); It; ++It) { Endpoints.Add(It.GetIndex()); }
 
 				switch (SortOver)
 				{
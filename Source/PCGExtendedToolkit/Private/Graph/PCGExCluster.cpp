@@ -3,11 +3,16 @@
 
 #include "Graph/PCGExCluster.h"
 
+#include "PCGExGlobalSettings.h"
 #include "PCGExMath.h"
 #include "Data/PCGExAttributeHelpers.h"
 #include "Data/PCGExPointIO.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGExDataTag.h"
+#include "Graph/Data/PCGExClusterCache.h"
+#include "Graph/Data/PCGExClusterData.h"
+#include "Graph/Pathfinding/Search/PCGExScoredQueue.h"
+#include "Async/ParallelFor.h"
 
 namespace PCGExCluster
 {
@@ -72,6 +77,130 @@ namespace PCGExCluster
 
 #pragma endregion
 
+#pragma region FFlatAdjacency
+
+	FFlatAdjacency::FFlatAdjacency(const TArray<FNode>& InNodes)
+	{
+		const int32 NumNodes = InNodes.Num();
+		Offsets.SetNumUninitialized(NumNodes + 1);
+
+		int32 NumLinks = 0;
+		for (int i = 0; i < NumNodes; i++)
+		{
+			Offsets[i] = NumLinks;
+			NumLinks += InNodes[i].Num();
+		}
+		Offsets[NumNodes] = NumLinks;
+
+		Links.SetNumUninitialized(NumLinks);
+		FLink* LinksData = Links.GetData();
+		for (int i = 0; i < NumNodes; i++)
+		{
+			const FNode& Node = InNodes[i];
+			FMemory::Memcpy(LinksData + Offsets[i], Node.Links.GetData(), Node.Num() * sizeof(FLink));
+		}
+	}
+
+#pragma endregion
+
+#pragma region FLandmarks
+
+	void FLandmarks::Build(const FCluster& InCluster, const int32 NumLandmarks)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExCluster::FLandmarks::Build);
+
+		NumNodes = InCluster.Nodes->Num();
+		NumRequested = NumLandmarks;
+		Nodes.Reset();
+		Distances.Reset();
+
+		if (!NumNodes || NumLandmarks <= 0) { return; }
+
+		// Farthest-point selection : start from the node farthest from the bounds center,
+		// then keep picking the node farthest from every landmark picked so far.
+
+		const FVector Center = InCluster.Bounds.GetCenter();
+
+		TArray<double> MinDist;
+		MinDist.Init(MAX_dbl, NumNodes);
+
+		int32 Pick = 0;
+		double BestDist = -1;
+		for (int i = 0; i < NumNodes; i++)
+		{
+			if (const double Dist = FVector::DistSquared(Center, InCluster.GetPos(i)); Dist > BestDist)
+			{
+				BestDist = Dist;
+				Pick = i;
+			}
+		}
+
+		while (Nodes.Num() < NumLandmarks)
+		{
+			Nodes.Add(Pick);
+
+			const FVector PickPos = InCluster.GetPos(Pick);
+			BestDist = -1;
+			for (int i = 0; i < NumNodes; i++)
+			{
+				MinDist[i] = FMath::Min(MinDist[i], FVector::DistSquared(PickPos, InCluster.GetPos(i)));
+				if (MinDist[i] > BestDist)
+				{
+					BestDist = MinDist[i];
+					Pick = i;
+				}
+			}
+
+			if (BestDist <= 0) { break; } // Every node is a landmark already
+		}
+
+		// One exact Dijkstra per landmark, in parallel
+
+		const int32 NumPicked = Nodes.Num();
+		Distances.SetNumUninitialized(NumPicked * NumNodes);
+
+		const TArray<double>& EdgeLengthsRef = *InCluster.EdgeLengths;
+
+		ParallelFor(
+			NumPicked, [&](const int32 LandmarkIndex)
+			{
+				double* Row = Distances.GetData() + LandmarkIndex * NumNodes;
+				for (int i = 0; i < NumNodes; i++) { Row[i] = MAX_dbl; }
+
+				PCGExSearch::FScoredQueue ScoredQueue(NumNodes, Nodes[LandmarkIndex], 0);
+
+				int32 CurrentNodeIndex;
+				double CurrentScore;
+				while (ScoredQueue.Dequeue(CurrentNodeIndex, CurrentScore))
+				{
+					if (Row[CurrentNodeIndex] != MAX_dbl) { continue; }
+					Row[CurrentNodeIndex] = CurrentScore;
+
+					for (const FLink Lk : InCluster.GetLinks(CurrentNodeIndex))
+					{
+						if (Row[Lk.Node] != MAX_dbl) { continue; }
+						ScoredQueue.Enqueue(Lk.Node, CurrentScore + EdgeLengthsRef[Lk.Edge]);
+					}
+				}
+			});
+	}
+
+	double FLandmarks::GetLowerBound(const int32 From, const int32 To) const
+	{
+		double Bound = 0;
+		const double* Row = Distances.GetData();
+		for (int i = 0; i < Nodes.Num(); i++, Row += NumNodes)
+		{
+			const double A = Row[From];
+			const double B = Row[To];
+			if (A == MAX_dbl || B == MAX_dbl) { continue; } // Unreachable from that landmark
+			Bound = FMath::Max(Bound, FMath::Abs(A - B));
+		}
+		return Bound;
+	}
+
+#pragma endregion
+
 #pragma region FCluster
 
 	FCluster::FCluster(const TSharedPtr<PCGExData::FPointIO>& InVtxIO, const TSharedPtr<PCGExData::FPointIO>& InEdgesIO,
@@ -106,6 +235,9 @@ namespace PCGExCluster
 
 		BoundedEdges = OriginalCluster->BoundedEdges;
 
+		// Topology is immutable once built, copied nodes can safely share the original adjacency
+		FlatAdjacency = OriginalCluster->FlatAdjacency;
+
 		if (bCopyNodes)
 		{
 			const int32 NumNewNodes = OriginalCluster->Nodes->Num();
@@ -187,6 +319,7 @@ namespace PCGExCluster
 		NodeOctree.Reset();
 		EdgeOctree.Reset();
 		BoundedEdges.Reset();
+		Landmarks.Reset();
 	}
 
 	FCluster::~FCluster()
@@ -263,6 +396,84 @@ namespace PCGExCluster
 		Nodes->Shrink();
 		Bounds = Bounds.ExpandBy(10);
 
+		if (GetDefault<UPCGExGlobalSettings>()->bBuildFlatClusterAdjacency) { BuildFlatAdjacency(); }
+
+		return true;
+	}
+
+	bool FCluster::BuildFromCache(
+		const TMap<uint32, int32>& InEndpointsLookup,
+		const TArray<int32>* InExpectedAdjacency)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExCluster::BuildClusterFromCache);
+
+		const TSharedPtr<PCGExData::FPointIO> PinnedVtxIO = VtxIO.Pin();
+		const TSharedPtr<PCGExData::FPointIO> PinnedEdgesIO = EdgesIO.Pin();
+
+		if (!PinnedVtxIO || !PinnedEdgesIO) { return false; }
+
+		const UPCGExClusterEdgesData* EdgesData = Cast<UPCGExClusterEdgesData>(PinnedEdgesIO->GetIn());
+		if (!EdgesData || EdgesData->GetClusterCache().IsEmpty()) { return false; }
+
+		const TUniquePtr<PCGExData::TArrayBuffer<int64>> EndpointsBuffer = MakeUnique<PCGExData::TArrayBuffer<int64>>(PinnedEdgesIO.ToSharedRef(), PCGExGraph::Attr_PCGExEdgeIdx);
+		if (!EndpointsBuffer->InitForRead()) { return false; }
+
+		PCGExClusterCache::FView View;
+		if (!PCGExClusterCache::Read(EdgesData->GetClusterCache(), *EndpointsBuffer->GetInValues().Get(), View)) { return false; }
+
+		const int32 NumNodes = View.NumNodes();
+		const int32 NumEdges = View.NumEdges();
+
+		// Resolve vtx ids against the current vtx before touching any state
+		TArray<int32> NodePointIndices;
+		NodePointIndices.SetNumUninitialized(NumNodes);
+
+		for (int i = 0; i < NumNodes; i++)
+		{
+			const int32* PointIndexPtr = InEndpointsLookup.Find(View.NodeVtxIds[i]);
+			if (!PointIndexPtr) { return false; }
+
+			// We care about removed connections, not new ones
+			if (InExpectedAdjacency && (*InExpectedAdjacency)[*PointIndexPtr] > View.LinkOffsets[i + 1] - View.LinkOffsets[i]) { return false; }
+
+			NodePointIndices[i] = *PointIndexPtr;
+		}
+
+		const UPCGBasePointData* InNodePoints = PinnedVtxIO->GetIn();
+		VtxTransforms = InNodePoints->GetConstTransformValueRange();
+
+		NumRawVtx = InNodePoints->GetNumPoints();
+		NumRawEdges = PinnedEdgesIO->GetNum();
+
+		const int32 EdgeIOIndex = PinnedEdgesIO->IOIndex;
+
+		Nodes->Reset(NumNodes);
+		for (int i = 0; i < NumNodes; i++)
+		{
+			const int32 PointIndex = NodePointIndices[i];
+			FNode& Node = Nodes->Emplace_GetRef(i, PointIndex);
+			Node.Links.Append(View.Links.GetData() + View.LinkOffsets[i], View.LinkOffsets[i + 1] - View.LinkOffsets[i]);
+
+			NodeIndexLookup->GetMutable(PointIndex) = i;
+			Bounds += VtxTransforms[PointIndex].GetLocation();
+		}
+
+		PCGEx::InitArray(Edges, NumEdges);
+		for (int i = 0; i < NumEdges; i++)
+		{
+			*(Edges->GetData() + i) = FEdge(i, NodePointIndices[View.EdgeNodes[i * 2]], NodePointIndices[View.EdgeNodes[i * 2 + 1]], i, EdgeIOIndex);
+		}
+
+		Bounds = Bounds.ExpandBy(10);
+
+		if (GetDefault<UPCGExGlobalSettings>()->bBuildFlatClusterAdjacency)
+		{
+			// Already flat in the cache
+			FlatAdjacency = MakeShared<FFlatAdjacency>();
+			FlatAdjacency->Offsets.Append(View.LinkOffsets.GetData(), View.LinkOffsets.Num());
+			FlatAdjacency->Links.Append(View.Links.GetData(), View.Links.Num());
+		}
+
 		return true;
 	}
 
@@ -301,6 +512,14 @@ namespace PCGExCluster
 		}
 
 		Bounds = Bounds.ExpandBy(10);
+
+		if (GetDefault<UPCGExGlobalSettings>()->bBuildFlatClusterAdjacency) { BuildFlatAdjacency(); }
+	}
+
+	void FCluster::BuildFlatAdjacency()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExCluster::BuildFlatAdjacency);
+		FlatAdjacency = MakeShared<FFlatAdjacency>(*Nodes);
 	}
 
 	bool FCluster::IsValidWith(const TSharedRef<PCGExData::FPointIO>& InVtxIO, const TSharedRef<PCGExData::FPointIO>& InEdgesIO) const
@@ -603,9 +822,7 @@ namespace PCGExCluster
 	void FCluster::GetConnectedNodes(const int32 FromIndex, TArray<int32>& OutIndices, const int32 SearchDepth) const
 	{
 		const int32 NextDepth = SearchDepth - 1;
-		const FNode& RootNode = (*Nodes)[FromIndex];
-
-		for (const FLink Lk : RootNode.Links)
+		for (const FLink Lk : GetLinks(FromIndex))
 		{
 			if (OutIndices.Contains(Lk.Node)) { continue; }
 
@@ -617,9 +834,7 @@ namespace PCGExCluster
 	void FCluster::GetConnectedNodes(const int32 FromIndex, TArray<int32>& OutIndices, const int32 SearchDepth, const TSet<int32>& Skip) const
 	{
 		const int32 NextDepth = SearchDepth - 1;
-		const FNode& RootNode = (*Nodes)[FromIndex];
-
-		for (const FLink Lk : RootNode.Links)
+		for (const FLink Lk : GetLinks(FromIndex))
 		{
 			if (Skip.Contains(Lk.Node) || OutIndices.Contains(Lk.Node)) { continue; }
 
@@ -631,9 +846,7 @@ namespace PCGExCluster
 	void FCluster::GetConnectedEdges(const int32 FromNodeIndex, TArray<int32>& OutNodeIndices, TArray<int32>& OutEdgeIndices, const int32 SearchDepth) const
 	{
 		const int32 NextDepth = SearchDepth - 1;
-		const FNode& RootNode = (*Nodes)[FromNodeIndex];
-
-		for (const FLink Lk : RootNode.Links)
+		for (const FLink Lk : GetLinks(FromNodeIndex))
 		{
 			if (OutNodeIndices.Contains(Lk.Node)) { continue; }
 			if (OutEdgeIndices.Contains(Lk.Edge)) { continue; }
@@ -648,9 +861,7 @@ namespace PCGExCluster
 	void FCluster::GetConnectedEdges(const int32 FromNodeIndex, TArray<int32>& OutNodeIndices, TArray<int32>& OutEdgeIndices, const int32 SearchDepth, const TSet<int32>& SkipNodes, const TSet<int32>& SkipEdges) const
 	{
 		const int32 NextDepth = SearchDepth - 1;
-		const FNode& RootNode = (*Nodes)[FromNodeIndex];
-
-		for (const FLink Lk : RootNode.Links)
+		for (const FLink Lk : GetLinks(FromNodeIndex))
 		{
 			if (SkipNodes.Contains(Lk.Node) || OutNodeIndices.Contains(Lk.Node)) { continue; }
 			if (SkipEdges.Contains(Lk.Edge) || OutEdgeIndices.Contains(Lk.Edge)) { continue; }
@@ -739,6 +950,30 @@ namespace PCGExCluster
 		return Result;
 	}
 
+	TSharedPtr<FLandmarks> FCluster::GetLandmarks(const int32 NumLandmarks) const
+	{
+		const int32 NumWanted = FMath::Min(NumLandmarks, Nodes->Num());
+
+		{
+			FReadScopeLock ReadScopeLock(ClusterLock);
+			if (Landmarks && Landmarks->NumRequested >= NumWanted) { return Landmarks; }
+		}
+
+		check(EdgeLengths)
+
+		// Build outside the lock, it's a Dijkstra per landmark; concurrent callers may build redundantly but won't block others
+		const TSharedPtr<FLandmarks> NewLandmarks = MakeShared<FLandmarks>();
+		NewLandmarks->Build(*this, NumWanted);
+
+		{
+			FWriteScopeLock WriteScopeLock(ClusterLock);
+			if (Landmarks && Landmarks->NumRequested >= NumWanted) { return Landmarks; }
+			Landmarks = NewLandmarks;
+		}
+
+		return NewLandmarks;
+	}
+
 	TSharedPtr<TArray<FBoundedEdge>> FCluster::GetBoundedEdges(const bool bBuild)
 	{
 		{
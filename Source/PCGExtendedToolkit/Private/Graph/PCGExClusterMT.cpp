@@ -83,7 +83,8 @@ namespace PCGExClusterMT
 			Cluster = MakeShared<PCGExCluster::FCluster>(VtxDataFacade->Source, EdgeDataFacade->Source, NodeIndexLookup);
 			Cluster->bIsOneToOne = bIsOneToOne;
 
-			if (!Cluster->BuildFrom(*EndpointsLookup, ExpectedAdjacency))
+			if (!Cluster->BuildFromCache(*EndpointsLookup, ExpectedAdjacency) &&
+				!Cluster->BuildFrom(*EndpointsLookup, ExpectedAdjacency))
 			{
 				PCGE_LOG_C(Error, GraphAndLog, ExecutionContext, FTEXT("A cluster could not be rebuilt correctly. If you did change the content of vtx/edges collections using non cluster-friendly nodes, make sure to use a 'Sanitize Cluster' to ensure clusters are validated."));
 				Cluster.Reset();
@@ -149,6 +149,9 @@ namespace PCGExConnectPoints
 
 		NumChainedOps = ChainProbeOperations.Num();
 
+		// Chained probes index into the full candidate list, and shared coincidence may skip any number of candidates
+		bCanBoundCandidates = NumChainedOps == 0 && !bPreventCoincidence && !SharedProbeOperations.IsEmpty();
+
 		if (SearchProbes.IsEmpty() && DirectProbes.IsEmpty()) { return false; }
 
 		if (!PointDataFacade->Source->InitializeOutput<UPCGExClusterNodesData>(PCGExData::EIOInit::New)) { return false; }
@@ -288,8 +291,44 @@ namespace PCGExConnectPoints
 
 				const FVector Origin = WorkingTransforms[Index].GetLocation();
 
+				// When every probe only reads the K closest candidates, keep those in a bounded max-heap instead of sorting them all
+				int32 MaxCandidates = -1;
+				if (bCanBoundCandidates)
+				{
+					MaxCandidates = 0;
+					for (const TSharedPtr<FPCGExProbeOperation>& Op : SharedProbeOperations)
+					{
+						const int32 OpMaxCandidates = Op->GetMaxCandidates(Index);
+						if (OpMaxCandidates < 0)
+						{
+							MaxCandidates = -1;
+							break;
+						}
+						MaxCandidates = FMath::Max(MaxCandidates, OpMaxCandidates);
+					}
+				}
+
 				TArray<PCGExProbing::FCandidate> Candidates;
 
+				auto FartherFirst = [](const PCGExProbing::FCandidate& A, const PCGExProbing::FCandidate& B) { return A.Distance > B.Distance; };
+
+				auto ProcessPointBounded = [&](const PCGExOctree::FItem& InPositionRef)
+				{
+					const int32 OtherPointIndex = InPositionRef.Index;
+					if (OtherPointIndex == Index) { return; }
+
+					const FVector Position = WorkingTransforms[OtherPointIndex].GetLocation();
+					const double Dist = FVector::DistSquared(Position, Origin);
+
+					if (Candidates.Num() >= MaxCandidates)
+					{
+						if (Dist >= Candidates.HeapTop().Distance) { return; }
+						Candidates.HeapPopDiscard(FartherFirst, EAllowShrinking::No);
+					}
+
+					Candidates.HeapPush(PCGExProbing::FCandidate(OtherPointIndex, (Origin - Position).GetSafeNormal(), Dist, FInt32Vector::ZeroValue), FartherFirst);
+				};
+
 				auto ProcessPoint = [&](const PCGExOctree::FItem& InPositionRef)
 				{
 					const int32 OtherPointIndex = InPositionRef.Index;
@@ -312,7 +351,15 @@ namespace PCGExConnectPoints
 					}
 				};
 
-				Octree->FindElementsWithBoundsTest(FBoxCenterAndExtent(Origin, FVector(MaxRadius)), ProcessPoint);
+				if (MaxCandidates > 0)
+				{
+					Candidates.Reserve(MaxCandidates);
+					Octree->FindElementsWithBoundsTest(FBoxCenterAndExtent(Origin, FVector(MaxRadius)), ProcessPointBounded);
+				}
+				else if (MaxCandidates < 0)
+				{
+					Octree->FindElementsWithBoundsTest(FBoxCenterAndExtent(Origin, FVector(MaxRadius)), ProcessPoint);
+				}
 
 				if (NumChainedOps > 0)
 				{
@@ -160,6 +160,9 @@ namespace PCGExCopyClustersToPoints
 			// Create an edge copy per target point
 			TSharedPtr<PCGExData::FPointIO> EdgeDupe = Context->MainEdges->Emplace_GetRef(EdgeDataFacade->Source, PCGExData::EIOInit::Duplicate);
 
+			// Forwarding replaces attributes, do it before the transform task touches the output
+			if (!Context->TargetsForwardHandler->IsEmpty()) { EdgeDupe->MaterializeOutput(); }
+
 			EdgesDupes[i] = EdgeDupe;
 			PCGExGraph::MarkClusterEdges(EdgeDupe, *(VtxTag->GetData() + i));
 
@@ -256,6 +259,7 @@ namespace PCGExCopyClustersToPoints
 
 			// Create a vtx copy per target point
 			TSharedPtr<PCGExData::FPointIO> VtxDupe = Context->MainPoints->Emplace_GetRef(VtxDataFacade->Source, PCGExData::EIOInit::Duplicate);
+			if (!Context->TargetsForwardHandler->IsEmpty()) { VtxDupe->MaterializeOutput(); }
 
 			PCGExCommon::DataIDType OutId;
 			PCGExGraph::SetClusterVtx(VtxDupe, OutId);
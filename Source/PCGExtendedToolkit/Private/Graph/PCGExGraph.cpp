@@ -283,14 +283,6 @@ MACRO(Crossing, bWriteCrossing, Crossing,TEXT("bCrossing"))
 		return -1;
 	}
 
-	void FSubGraph::Add(const FEdge& Edge, FGraph* InGraph)
-	{
-		Nodes.Add(Edge.Start);
-		Nodes.Add(Edge.End);
-		Edges.Add(Edge.Index);
-		if (Edge.IOIndex >= 0) { EdgesInIOIndices.Add(Edge.IOIndex); }
-	}
-
 	void FSubGraph::Invalidate(FGraph* InGraph)
 	{
 		for (const int32 EdgeIndex : Edges) { InGraph->Edges[EdgeIndex].bValid = false; }
@@ -329,7 +321,7 @@ MACRO(Crossing, bWriteCrossing, Crossing,TEXT("bCrossing"))
 		WeakAsyncManager = AsyncManager;
 
 		const int32 NumEdges = Edges.Num();
-		TArray<int32> EdgeDump = Edges.Array();
+		TArray<int32> EdgeDump = Edges;
 
 		{
 			TRACE_CPUPROFILER_EVENT_SCOPE(FWriteSubGraphEdges::EdgeSorting);
@@ -882,70 +874,153 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 		return MakeArrayView(Nodes.GetData() + OutStartIndex, NumNewNodes);
 	}
 
+	namespace UnionFind
+	{
+		// Lock-free disjoint set over an array of parent indices.
+		// Roots are always hooked under the smallest index, so each root ends up being the smallest node index of its component
+		// which keeps component order independent from scheduling.
+
+		FORCEINLINE int32 Find(int32* Parents, int32 X)
+		{
+			while (true)
+			{
+				const int32 P = FPlatformAtomics::AtomicRead(Parents + X);
+				if (P == X) { return X; }
+
+				const int32 GP = FPlatformAtomics::AtomicRead(Parents + P);
+				if (P != GP) { FPlatformAtomics::InterlockedCompareExchange(Parents + X, GP, P); } // Path halving
+
+				X = GP;
+			}
+		}
+
+		FORCEINLINE void Union(int32* Parents, int32 A, int32 B)
+		{
+			while (true)
+			{
+				A = Find(Parents, A);
+				B = Find(Parents, B);
+
+				if (A == B) { return; }
+				if (A < B) { Swap(A, B); }
+
+				if (FPlatformAtomics::InterlockedCompareExchange(Parents + A, B, A) == A) { return; }
+			}
+		}
+	}
+
 	void FGraph::BuildSubGraphs(const FPCGExGraphBuilderDetails& Limits)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FGraph::BuildSubGraphs);
 
-		TBitArray<> VisitedNodes;
-		TBitArray<> VisitedEdges;
-		VisitedNodes.Init(false, Nodes.Num());
-		VisitedEdges.Init(false, Edges.Num());
+		const int32 NumNodes = Nodes.Num();
+		const int32 NumEdges = Edges.Num();
+
+		const EParallelForFlags NodeFlags = NumNodes < 1024 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None;
+		const EParallelForFlags EdgeFlags = NumEdges < 1024 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None;
 
-		int32 VisitedNum = 0;
+		auto IsLive = [&](const FEdge& Edge) { return Edge.bValid && Nodes[Edge.Start].bValid && Nodes[Edge.End].bValid; };
+
+		TArray<int32> Roots;
+		PCGEx::ArrayOfIndices(Roots, NumNodes);
+		int32* RootsData = Roots.GetData();
 
-		for (int i = 0; i < Nodes.Num(); i++)
 		{
-			const FNode& CurrentNode = Nodes[i];
+			TRACE_CPUPROFILER_EVENT_SCOPE(FGraph::BuildSubGraphs::Union);
 
-			if (VisitedNodes[i]) { continue; }
+			ParallelFor(
+				NumEdges, [&](const int32 i)
+				{
+					const FEdge& Edge = Edges[i];
+					if (IsLive(Edge)) { UnionFind::Union(RootsData, Edge.Start, Edge.End); }
+				}, EdgeFlags);
+		}
 
-			VisitedNodes[i] = true;
-			VisitedNum++;
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(FGraph::BuildSubGraphs::Flatten);
 
-			if (!CurrentNode.bValid || CurrentNode.IsEmpty()) { continue; }
+			ParallelFor(
+				NumNodes, [&](const int32 i)
+				{
+					FNode& Node = Nodes[i];
+					Node.NumExportedEdges = 0;
 
-			PCGEX_MAKE_SHARED(SubGraph, FSubGraph)
-			SubGraph->WeakParentGraph = SharedThis(this);
+					if (!Node.bValid) { return; }
 
-			TArray<int32> Stack;
-			Stack.Reserve(Nodes.Num() - VisitedNum);
-			Stack.Add(i);
+					for (const FLink Lk : Node.Links) { if (IsLive(Edges[Lk.Edge])) { Node.NumExportedEdges++; } }
+					RootsData[i] = UnionFind::Find(RootsData, i);
+				}, NodeFlags);
+		}
+
+		// Assign component ids in ascending root order so subgraphs come out in the same order as a sequential traversal would
+
+		TArray<int32> ComponentIndices;
+		ComponentIndices.Init(-1, NumNodes);
+
+		TArray<int32> NodeCounts;
+		TArray<int32> EdgeCounts;
 
-			while (Stack.Num() > 0)
+		for (int i = 0; i < NumNodes; i++)
+		{
+			const FNode& Node = Nodes[i];
+			if (!Node.bValid || !Node.NumExportedEdges) { continue; }
+
+			int32& ComponentIndex = ComponentIndices[Roots[i]];
+			if (ComponentIndex == -1)
 			{
-				const int32 NextIndex = Stack.Pop(EAllowShrinking::No);
-				FNode& Node = Nodes[NextIndex];
-				Node.NumExportedEdges = 0;
+				ComponentIndex = NodeCounts.Add(0);
+				EdgeCounts.Add(0);
+			}
 
-				for (const FLink Lk : Node.Links)
-				{
-					const int32 E = Lk.Edge;
+			NodeCounts[ComponentIndex]++;
+		}
 
-					if (VisitedEdges[E]) { continue; }
-					VisitedEdges[E] = true;
+		const int32 NumComponents = NodeCounts.Num();
+		if (!NumComponents) { return; }
 
-					const FEdge& Edge = Edges[E];
+		for (int i = 0; i < NumEdges; i++)
+		{
+			const FEdge& Edge = Edges[i];
+			if (IsLive(Edge)) { EdgeCounts[ComponentIndices[Roots[Edge.Start]]]++; }
+		}
 
-					if (!Edge.bValid) { continue; }
+		// Counting sort nodes & edges into their subgraph
 
-					const int32 OtherIndex = Edge.Other(NextIndex);
-					if (!Nodes[OtherIndex].bValid) { continue; }
+		TArray<TSharedPtr<FSubGraph>> Components;
+		Components.SetNum(NumComponents);
 
-					Node.NumExportedEdges++;
-					SubGraph->Add(Edge, this);
+		for (int i = 0; i < NumComponents; i++)
+		{
+			PCGEX_MAKE_SHARED(SubGraph, FSubGraph)
+			SubGraph->WeakParentGraph = SharedThis(this);
+			SubGraph->Nodes.Reserve(NodeCounts[i]);
+			SubGraph->Edges.Reserve(EdgeCounts[i]);
+			Components[i] = SubGraph;
+		}
 
-					if (!VisitedNodes[OtherIndex]) // Only enqueue if not already visited
-					{
-						VisitedNodes[OtherIndex] = true;
-						VisitedNum++;
+		for (int i = 0; i < NumNodes; i++)
+		{
+			const FNode& Node = Nodes[i];
+			if (!Node.bValid || !Node.NumExportedEdges) { continue; }
+			Components[ComponentIndices[Roots[i]]]->Nodes.Add(i);
+		}
 
-						Stack.Add(OtherIndex);
-					}
-				}
-			}
+		for (int i = 0; i < NumEdges; i++)
+		{
+			const FEdge& Edge = Edges[i];
+			if (!IsLive(Edge)) { continue; }
+
+			const TSharedPtr<FSubGraph>& SubGraph = Components[ComponentIndices[Roots[Edge.Start]]];
+			SubGraph->Edges.Add(Edge.Index);
+			if (Edge.IOIndex >= 0) { SubGraph->EdgesInIOIndices.Add(Edge.IOIndex); }
+		}
 
+		SubGraphs.Reserve(NumComponents);
+
+		for (const TSharedPtr<FSubGraph>& SubGraph : Components)
+		{
 			if (!Limits.IsValid(SubGraph)) { SubGraph->Invalidate(this); } // Will invalidate isolated points
-			else if (!SubGraph->Edges.IsEmpty()) { SubGraphs.Add(SubGraph.ToSharedRef()); }
+			else { SubGraphs.Add(SubGraph.ToSharedRef()); }
 		}
 	}
 
@@ -1081,6 +1156,9 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 		{
 			TRACE_CPUPROFILER_EVENT_SCOPE(FCompileGraph::PrunePoints);
 
+			// Both branches below resize or reorder the output
+			NodeDataFacade->Source->MaterializeOutput();
+
 			const UPCGBasePointData* InNodeData = NodeDataFacade->GetIn();
 			UPCGBasePointData* OutNodeData = NodeDataFacade->GetOut();
 
@@ -1360,6 +1438,7 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 	void CleanupVtxData(const TSharedPtr<PCGExData::FPointIO>& PointIO)
 	{
 		if (!PointIO->GetOut()) { return; }
+		PointIO->MaterializeOutput();
 		UPCGMetadata* Metadata = PointIO->GetOut()->MutableMetadata();
 		PointIO->Tags->Remove(TagStr_PCGExCluster);
 		PointIO->Tags->Remove(TagStr_PCGExVtx);
@@ -1370,6 +1449,7 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 	void CleanupEdgeData(const TSharedPtr<PCGExData::FPointIO>& PointIO)
 	{
 		if (!PointIO->GetOut()) { return; }
+		PointIO->MaterializeOutput();
 		UPCGMetadata* Metadata = PointIO->GetOut()->MutableMetadata();
 		PointIO->Tags->Remove(TagStr_PCGExCluster);
 		PointIO->Tags->Remove(TagStr_PCGExEdges);
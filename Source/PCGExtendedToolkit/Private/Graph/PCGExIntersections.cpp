@@ -6,6 +6,7 @@
 #include "PCGExDetailsIntersection.h"
 #include "PCGExMath.h"
 #include "PCGExPointsProcessor.h"
+#include "Async/ParallelFor.h"
 
 
 #include "Graph/PCGExCluster.h"
@@ -22,11 +23,12 @@ namespace PCGExGraph
 	FVector FUnionNode::UpdateCenter(const TSharedPtr<PCGExData::FUnionMetadata>& InUnionMetadata, const TSharedPtr<PCGExData::FPointIOCollection>& IOGroup)
 	{
 		Center = FVector::ZeroVector;
-		const TSharedPtr<PCGExData::IUnionData> UnionData = InUnionMetadata->Get(Index);
 
-		const double Divider = UnionData->Elements.Num();
+		const TConstArrayView<PCGExData::FElement> Elements = InUnionMetadata->IsFlat() ? InUnionMetadata->GetFlatElements(Index) : TConstArrayView<PCGExData::FElement>(InUnionMetadata->Get(Index)->Elements);
 
-		for (const PCGExData::FElement& H : UnionData->Elements)
+		const double Divider = Elements.Num();
+
+		for (const PCGExData::FElement& H : Elements)
 		{
 			Center += IOGroup->Pairs[H.IO]->GetIn()->GetTransform(H.Index).GetLocation();
 		}
@@ -41,6 +43,33 @@ namespace PCGExGraph
 		Adjacency.Add(InAdjacency);
 	}
 
+	bool FUnionNode::Rebase(const PCGExData::FConstPoint& InPoint, const FVector& InCenter)
+	{
+		if (InPoint.IO > Point.IO || (InPoint.IO == Point.IO && InPoint.Index >= Point.Index)) { return false; }
+
+		Point = InPoint;
+		Center = InCenter;
+		Bounds = FBoxSphereBounds(InPoint.Data->GetLocalBounds(InPoint.Index).TransformBy(InPoint.Data->GetTransform(InPoint.Index)));
+		return true;
+	}
+
+	FUnionNodePool::~FUnionNodePool()
+	{
+		ForEach([](FUnionNode* Node) { Node->~FUnionNode(); });
+		for (FUnionNode* Chunk : Chunks) { FMemory::Free(Chunk); }
+	}
+
+	FUnionNode* FUnionNodePool::Emplace(const PCGExData::FConstPoint& InPoint, const FVector& InCenter, const int32 InIndex)
+	{
+		const int32 Slot = NumNodes % ChunkSize;
+		if (Slot == 0) { Chunks.Add(static_cast<FUnionNode*>(FMemory::Malloc(sizeof(FUnionNode) * ChunkSize, alignof(FUnionNode)))); }
+
+		FUnionNode* Node = new(Chunks.Last() + Slot) FUnionNode(InPoint, InCenter, InIndex);
+		NumNodes++;
+
+		return Node;
+	}
+
 	FUnionGraph::FUnionGraph(const FPCGExFuseDetails& InFuseDetails, const FBox& InBounds)
 		: FuseDetails(InFuseDetails), Bounds(InBounds)
 	{
@@ -66,45 +95,92 @@ namespace PCGExGraph
 		return FuseDetails.Init(InContext, InUniqueSourceFacade);
 	}
 
-	TSharedPtr<FUnionNode> FUnionGraph::InsertPoint(const PCGExData::FConstPoint& Point)
+	FUnionNode* FUnionGraph::NewNode_Unsafe(FShard& Shard, const PCGExData::FConstPoint& Point, const FVector& Origin)
+	{
+		// Provisional index, in insertion order; remapped by Collapse() if insertion was concurrent
+		FUnionNode* Node = Shard.Pool.Emplace(Point, Origin, NumInsertedNodes.fetch_add(1, std::memory_order_relaxed));
+		Node->Union = MakeShared<PCGExData::IUnionData>();
+		Node->Union->Add(Point);
+		return Node;
+	}
+
+	FUnionNode* FUnionGraph::FindOctreeNode_Unsafe(const PCGExData::FConstPoint& Point, const FVector& Origin) const
+	{
+		PCGExMath::FClosestPosition ClosestNode(Origin);
+		FUnionNode* Closest = nullptr;
+
+		if (FuseDetails.bComponentWiseTolerance)
+		{
+			Octree->FindElementsWithBoundsTest(
+				FuseDetails.GetOctreeBox(Origin, Point.Index), [&](FUnionNode* ExistingNode)
+				{
+					if (FuseDetails.IsWithinToleranceComponentWise(Point, ExistingNode->Point))
+					{
+						if (ClosestNode.Update(ExistingNode->Center, ExistingNode->Index)) { Closest = ExistingNode; }
+						return false;
+					}
+					return true;
+				});
+		}
+		else
+		{
+			Octree->FindElementsWithBoundsTest(
+				FuseDetails.GetOctreeBox(Origin, Point.Index), [&](FUnionNode* ExistingNode)
+				{
+					if (FuseDetails.IsWithinTolerance(Point, ExistingNode->Point))
+					{
+						if (ClosestNode.Update(ExistingNode->Center, ExistingNode->Index)) { Closest = ExistingNode; }
+						return false;
+					}
+					return true;
+				});
+		}
+
+		return Closest;
+	}
+
+	FUnionNode* FUnionGraph::InsertPoint(const PCGExData::FConstPoint& Point)
 	{
 		const FVector Origin = Point.GetLocation();
 
-		TSharedPtr<FUnionNode> Node;
+		FUnionNode* Node = nullptr;
 
 		if (!Octree)
 		{
 			const uint32 GridKey = FuseDetails.GetGridKey(Origin, Point.Index);
-			TSharedPtr<FUnionNode>* NodePtr;
+			FShard& Shard = GetShard(GridKey);
 
 			{
-				FReadScopeLock ReadScopeLock(UnionLock);
-				NodePtr = GridTree.Find(GridKey);
-
+				FReadScopeLock ReadScopeLock(Shard.Lock);
 
-				if (NodePtr)
+				if (FUnionNode** NodePtr = Shard.Cells.Find(GridKey))
 				{
 					Node = *NodePtr;
-					NodesUnion->Append(Node->Index, Point);
-					return Node;
+
+					// Representative point must not depend on arrival order; defer to the write path when it would change
+					if (Point.IO > Node->Point.IO || (Point.IO == Node->Point.IO && Point.Index > Node->Point.Index))
+					{
+						Node->Union->Add(Point);
+						return Node;
+					}
 				}
 			}
 
 			{
-				FWriteScopeLock WriteLock(UnionLock);
-				NodePtr = GridTree.Find(GridKey); // Make sure there hasn't been an insert while locking
+				FWriteScopeLock WriteLock(Shard.Lock);
 
-				if (NodePtr)
+				if (FUnionNode** NodePtr = Shard.Cells.Find(GridKey)) // Make sure there hasn't been an insert while locking
 				{
 					Node = *NodePtr;
-					NodesUnion->Append(Node->Index, Point);
+					Node->Rebase(Point, Origin);
+					Node->Union->Add(Point);
 					return Node;
 				}
 
-				Node = MakeShared<FUnionNode>(Point, Origin, Nodes.Num());
-				Nodes.Add(Node);
-				NodesUnion->NewEntry_Unsafe(Point);
-				GridTree.Add(GridKey, Node);
+				bConcurrentInsertion.store(true, std::memory_order_relaxed);
+
+				Node = NewNode_Unsafe(Shard, Point, Origin);
+				Shard.Cells.Add(GridKey, Node);
 			}
 
 			return Node;
@@ -114,123 +190,61 @@ namespace PCGExGraph
 			// Write lock starts
 			FWriteScopeLock WriteScopeLock(UnionLock);
 
-			PCGExMath::FClosestPosition ClosestNode(Origin);
+			bConcurrentInsertion.store(true, std::memory_order_relaxed);
 
-			if (FuseDetails.bComponentWiseTolerance)
-			{
-				Octree->FindElementsWithBoundsTest(
-					FuseDetails.GetOctreeBox(Origin, Point.Index), [&](const FUnionNode* ExistingNode)
-					{
-						if (FuseDetails.IsWithinToleranceComponentWise(Point, ExistingNode->Point))
-						{
-							ClosestNode.Update(ExistingNode->Center, ExistingNode->Index);
-							return false;
-						}
-						return true;
-					});
-			}
-			else
-			{
-				Octree->FindElementsWithBoundsTest(
-					FuseDetails.GetOctreeBox(Origin, Point.Index), [&](const FUnionNode* ExistingNode)
-					{
-						if (FuseDetails.IsWithinTolerance(Point, ExistingNode->Point))
-						{
-							ClosestNode.Update(ExistingNode->Center, ExistingNode->Index);
-							return false;
-						}
-						return true;
-					});
-			}
+			Node = FindOctreeNode_Unsafe(Point, Origin);
 
-			if (ClosestNode.bValid)
+			if (Node)
 			{
-				NodesUnion->Append(ClosestNode.Index, Point);
-				return Nodes[ClosestNode.Index];
+				Node->Union->Add(Point);
+				return Node;
 			}
 
-			// Write lock ends
-		}
+			Node = NewNode_Unsafe(Shards[0], Point, Origin);
+			Octree->AddElement(Node);
 
-		{
-			// Write lock start
-			FWriteScopeLock WriteScopeLock(UnionLock);
-
-			Node = MakeShared<FUnionNode>(Point, Origin, Nodes.Num());
-			Nodes.Add(Node);
-			Octree->AddElement(Node.Get());
-			NodesUnion->NewEntry_Unsafe(Point);
+			// Write lock ends
 		}
 
 		return Node;
 	}
 
-	TSharedPtr<FUnionNode> FUnionGraph::InsertPoint_Unsafe(const PCGExData::FConstPoint& Point)
+	FUnionNode* FUnionGraph::InsertPoint_Unsafe(const PCGExData::FConstPoint& Point)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FUnionGraph::InsertPoint_Unsafe);
 
 		const FVector Origin = Point.GetLocation();
 
-		TSharedPtr<FUnionNode> Node;
+		FUnionNode* Node = nullptr;
 
 		if (!Octree)
 		{
 			const uint32 GridKey = FuseDetails.GetGridKey(Origin, Point.Index);
+			FShard& Shard = GetShard(GridKey);
 
-			if (TSharedPtr<FUnionNode>* NodePtr = GridTree.Find(GridKey))
+			if (FUnionNode** NodePtr = Shard.Cells.Find(GridKey))
 			{
 				Node = *NodePtr;
-				NodesUnion->Append(Node->Index, Point);
+				Node->Union->Add_Unsafe(Point);
 				return Node;
 			}
 
-			Node = MakeShared<FUnionNode>(Point, Origin, Nodes.Num());
-			Nodes.Add(Node);
-			NodesUnion->NewEntry_Unsafe(Point);
-			GridTree.Add(GridKey, Node);
+			Node = NewNode_Unsafe(Shard, Point, Origin);
+			Shard.Cells.Add(GridKey, Node);
 
 			return Node;
 		}
 
-		PCGExMath::FClosestPosition ClosestNode(Origin);
-
-		if (FuseDetails.bComponentWiseTolerance)
-		{
-			Octree->FindElementsWithBoundsTest(
-				FuseDetails.GetOctreeBox(Origin, Point.Index), [&](const FUnionNode* ExistingNode)
-				{
-					if (FuseDetails.IsWithinToleranceComponentWise(Point, ExistingNode->Point))
-					{
-						ClosestNode.Update(ExistingNode->Center, ExistingNode->Index);
-						return false;
-					}
-					return true;
-				});
-		}
-		else
-		{
-			Octree->FindElementsWithBoundsTest(
-				FuseDetails.GetOctreeBox(Origin, Point.Index), [&](const FUnionNode* ExistingNode)
-				{
-					if (FuseDetails.IsWithinTolerance(Point, ExistingNode->Point))
-					{
-						ClosestNode.Update(ExistingNode->Center, ExistingNode->Index);
-						return false;
-					}
-					return true;
-				});
-		}
+		Node = FindOctreeNode_Unsafe(Point, Origin);
 
-		if (ClosestNode.bValid)
+		if (Node)
 		{
-			NodesUnion->Append(ClosestNode.Index, Point);
-			return Nodes[ClosestNode.Index];
+			Node->Union->Add_Unsafe(Point);
+			return Node;
 		}
 
-		Node = MakeShared<FUnionNode>(Point, Origin, Nodes.Num());
-		Nodes.Add(Node);
-		Octree->AddElement(Node.Get());
-		NodesUnion->NewEntry_Unsafe(Point);
+		Node = NewNode_Unsafe(Shards[0], Point, Origin);
+		Octree->AddElement(Node);
 
 		return Node;
 	}
@@ -239,8 +253,8 @@ namespace PCGExGraph
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(IUnionData::InsertEdge);
 
-		const TSharedPtr<FUnionNode> StartVtx = InsertPoint(From);
-		const TSharedPtr<FUnionNode> EndVtx = InsertPoint(To);
+		FUnionNode* StartVtx = InsertPoint(From);
+		FUnionNode* EndVtx = InsertPoint(To);
 
 		if (StartVtx == EndVtx) { return nullptr; } // Edge got fused entirely
 
@@ -303,8 +317,8 @@ namespace PCGExGraph
 
 	TSharedPtr<PCGExData::IUnionData> FUnionGraph::InsertEdge_Unsafe(const PCGExData::FConstPoint& From, const PCGExData::FConstPoint& To, const PCGExData::FConstPoint& Edge)
 	{
-		const TSharedPtr<FUnionNode> StartVtx = InsertPoint_Unsafe(From);
-		const TSharedPtr<FUnionNode> EndVtx = InsertPoint_Unsafe(To);
+		FUnionNode* StartVtx = InsertPoint_Unsafe(From);
+		FUnionNode* EndVtx = InsertPoint_Unsafe(To);
 
 		if (StartVtx == EndVtx) { return nullptr; } // Edge got fused entirely
 
@@ -352,10 +366,111 @@ namespace PCGExGraph
 		return EdgeUnion;
 	}
 
+	void FUnionGraph::Collapse()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FUnionGraph::Collapse);
+
+		if (bCollapsed) { return; }
+		bCollapsed = true;
+
+		const int32 NumUnionNodes = NumInsertedNodes.load();
+
+		Nodes.SetNumUninitialized(NumUnionNodes);
+		for (const FShard& Shard : Shards) { Shard.Pool.ForEach([&](FUnionNode* Node) { Nodes[Node->Index] = Node; }); }
+
+		if (bConcurrentInsertion.load())
+		{
+			// Concurrent insertion leaves node indices, edge indices and union element order up to scheduling.
+			// Everything is re-sorted by input (IO, Index), so the result is deterministic regardless of thread count,
+			// though not necessarily identical to what an edge-driven single-threaded insertion would have produced.
+
+			auto ElementLess = [](const PCGExData::FElement& A, const PCGExData::FElement& B) { return A.IO < B.IO || (A.IO == B.IO && A.Index < B.Index); };
+
+			ParallelFor(
+				NumUnionNodes, [&](const int32 i)
+				{
+					Nodes[i]->Union->Elements.Sort(ElementLess);
+				});
+
+			Nodes.Sort([&](const FUnionNode& A, const FUnionNode& B) { return ElementLess(A.Union->Elements[0], B.Union->Elements[0]); });
+
+			TArray<int32> Remap;
+			Remap.SetNumUninitialized(NumUnionNodes);
+			for (int32 i = 0; i < NumUnionNodes; i++)
+			{
+				Remap[Nodes[i]->Index] = i;
+				Nodes[i]->Index = i;
+			}
+
+			ParallelFor(
+				NumUnionNodes, [&](const int32 i)
+				{
+					FUnionNode* Node = Nodes[i];
+					if (Node->Adjacency.IsEmpty()) { return; }
+
+					TArray<int32, TInlineAllocator<8>> Adjacency;
+					Adjacency.Reserve(Node->Adjacency.Num());
+					for (const int32 Adj : Node->Adjacency) { Adjacency.Add(Remap[Adj]); }
+					Adjacency.Sort();
+
+					Node->Adjacency.Reset();
+					Node->Adjacency.Append(Adjacency);
+				});
+
+			if (!Edges.IsEmpty())
+			{
+				TArray<FEdge> SortedEdges;
+				GetUniqueEdges(SortedEdges);
+
+				ParallelFor(
+					SortedEdges.Num(), [&](const int32 i)
+					{
+						FEdge& E = SortedEdges[i];
+						const int32 A = Remap[E.Start];
+						const int32 B = Remap[E.End];
+
+						// Orientation depends on which insertion came first, normalize it
+						E.Start = FMath::Min(A, B);
+						E.End = FMath::Max(A, B);
+
+						EdgesUnion->Entries[E.Index]->Elements.Sort(ElementLess);
+					});
+
+				SortedEdges.Sort(
+					[&](const FEdge& A, const FEdge& B)
+					{
+						const PCGExData::FElement& EA = EdgesUnion->Entries[A.Index]->Elements[0];
+						const PCGExData::FElement& EB = EdgesUnion->Entries[B.Index]->Elements[0];
+						if (EA == EB) { return A.Start < B.Start || (A.Start == B.Start && A.End < B.End); }
+						return ElementLess(EA, EB);
+					});
+
+				TArray<TSharedPtr<PCGExData::IUnionData>> SortedEntries;
+				SortedEntries.SetNum(SortedEdges.Num());
+
+				Edges.Reset();
+				for (int32 i = 0; i < SortedEdges.Num(); i++)
+				{
+					FEdge& E = SortedEdges[i];
+					SortedEntries[i] = EdgesUnion->Entries[E.Index];
+					E.Index = i;
+					Edges.Add(PCGEx::H64U(E.Start, E.End), E);
+				}
+
+				EdgesUnion->Entries = MoveTemp(SortedEntries);
+			}
+		}
+
+		NodesUnion->Entries.SetNum(NumUnionNodes);
+		for (int32 i = 0; i < NumUnionNodes; i++) { NodesUnion->Entries[i] = Nodes[i]->Union; }
+
+		NodesUnion->Flatten();
+	}
+
 	void FUnionGraph::GetUniqueEdges(TSet<uint64>& OutEdges)
 	{
 		OutEdges.Empty(Nodes.Num() * 4);
-		for (const TSharedPtr<FUnionNode>& Node : Nodes)
+		for (const FUnionNode* Node : Nodes)
 		{
 			for (const int32 OtherNodeIndex : Node->Adjacency)
 			{
@@ -376,7 +491,7 @@ namespace PCGExGraph
 	{
 		InGraph->NodeMetadata.Reserve(Nodes.Num());
 
-		for (const TSharedPtr<FUnionNode>& Node : Nodes)
+		for (const FUnionNode* Node : Nodes)
 		{
 			const TSharedPtr<PCGExData::IUnionData>& UnionData = NodesUnion->Entries[Node->Index];
 			FGraphNodeMetadata& NodeMeta = InGraph->GetOrCreateNodeMetadata_Unsafe(Node->Index);
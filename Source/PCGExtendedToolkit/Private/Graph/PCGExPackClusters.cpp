@@ -88,6 +88,7 @@ namespace PCGExPackClusters
 
 		// Copy vtx points after edge points
 		const UPCGBasePointData* VtxPoints = VtxDataFacade->GetIn();
+		PackedIO->MaterializeOutput();
 		UPCGBasePointData* PackedPoints = PackedIO->GetOut();
 		PCGEx::SetNumPointsAllocated(PackedPoints, VtxStartIndex + NumVtx, AllocateProperties);
 
@@ -54,6 +54,8 @@ namespace PCGExGraph
 	{
 		BuilderDetails = InBuilderDetails;
 
+		UnionGraph->Collapse();
+
 		const int32 NumUnionNodes = UnionGraph->Nodes.Num();
 		if (NumUnionNodes == 0)
 		{
@@ -104,7 +106,7 @@ namespace PCGExGraph
 
 				PCGEX_SCOPE_LOOP(Index)
 				{
-					TSharedPtr<FUnionNode> UnionNode = This->UnionGraph->Nodes[Index];
+					FUnionNode* UnionNode = This->UnionGraph->Nodes[Index];
 
 					//const PCGMetadataEntryKey Key = OutPoints[i].MetadataEntry;
 					//OutPoints[Index] = UnionNode->Point; // Copy "original" point properties, in case  there's only one
@@ -0,0 +1,57 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+
+#include "Graph/Pathfinding/Heuristics/PCGExHeuristicLandmarks.h"
+
+
+void FPCGExHeuristicLandmarks::PrepareForCluster(const TSharedPtr<const PCGExCluster::FCluster>& InCluster)
+{
+	FPCGExHeuristicOperation::PrepareForCluster(InCluster);
+	Landmarks = InCluster->GetLandmarks(NumLandmarks); // Shared by every heuristic & query on that cluster
+}
+
+double FPCGExHeuristicLandmarks::GetGlobalScore(
+	const PCGExCluster::FNode& From,
+	const PCGExCluster::FNode& Seed,
+	const PCGExCluster::FNode& Goal) const
+{
+	return Landmarks->GetLowerBound(From.Index, Goal.Index) * ReferenceWeight;
+}
+
+double FPCGExHeuristicLandmarks::GetEdgeScore(
+	const PCGExCluster::FNode& From,
+	const PCGExCluster::FNode& To,
+	const PCGExGraph::FEdge& Edge,
+	const PCGExCluster::FNode& Seed,
+	const PCGExCluster::FNode& Goal,
+	const TSharedPtr<PCGEx::FHashLookup> TravelStack) const
+{
+	return (*Cluster->EdgeLengths)[Edge.Index] * ReferenceWeight;
+}
+
+TSharedPtr<FPCGExHeuristicOperation> UPCGExHeuristicsFactoryLandmarks::CreateOperation(FPCGExContext* InContext) const
+{
+	PCGEX_FACTORY_NEW_OPERATION(HeuristicLandmarks)
+	PCGEX_FORWARD_HEURISTIC_CONFIG
+	NewOperation->NumLandmarks = Config.NumLandmarks;
+	return NewOperation;
+}
+
+PCGEX_HEURISTIC_FACTORY_BOILERPLATE_IMPL(Landmarks, {})
+
+UPCGExFactoryData* UPCGExHeuristicsLandmarksProviderSettings::CreateFactory(FPCGExContext* InContext, UPCGExFactoryData* InFactory) const
+{
+	UPCGExHeuristicsFactoryLandmarks* NewFactory = InContext->ManagedObjects->New<UPCGExHeuristicsFactoryLandmarks>();
+	PCGEX_FORWARD_HEURISTIC_FACTORY
+	return Super::CreateFactory(InContext, NewFactory);
+}
+
+#if WITH_EDITOR
+FString UPCGExHeuristicsLandmarksProviderSettings::GetDisplayName() const
+{
+	return GetDefaultNodeTitle().ToString().Replace(TEXT("PCGEx | Heuristics"), TEXT("HX"))
+		+ TEXT(" @ ")
+		+ FString::Printf(TEXT("%.3f"), (static_cast<int32>(1000 * Config.WeightFactor) / 1000.0));
+}
+#endif
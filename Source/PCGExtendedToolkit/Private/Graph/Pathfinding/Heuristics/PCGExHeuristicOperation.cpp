@@ -53,6 +53,10 @@ double FPCGExHeuristicOperation::GetEdgeScore(const PCGExCluster::FNode& From, c
 	return GetScoreInternal(0);
 }
 
+bool FPCGExHeuristicOperation::UsesGoal() const { return false; }
+
+bool FPCGExHeuristicOperation::UsesTravelStack() const { return false; }
+
 double FPCGExHeuristicOperation::GetCustomWeightMultiplier(const int32 PointIndex, const int32 EdgeIndex) const
 {
 	//TODO Rewrite this
@@ -91,6 +91,18 @@ namespace PCGExHeuristics
 		for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations) { TotalStaticWeight += Op->WeightFactor; }
 	}
 
+	bool FHeuristicsHandler::IsGoalAgnostic() const
+	{
+		for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations) { if (Op->UsesGoal()) { return false; } }
+		return true;
+	}
+
+	bool FHeuristicsHandler::IsTravelAgnostic() const
+	{
+		for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations) { if (Op->UsesTravelStack()) { return false; } }
+		return true;
+	}
+
 	double FHeuristicsHandler::GetGlobalScore(
 		const PCGExCluster::FNode& From,
 		const PCGExCluster::FNode& Seed,
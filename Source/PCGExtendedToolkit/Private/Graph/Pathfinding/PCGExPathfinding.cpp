@@ -131,6 +131,47 @@ namespace PCGExPathfinding
 		}
 	}
 
+	void FPathQuery::FindPath(
+		PCGEx::FHashLookupStamped* TravelStack,
+		const bool bRootedAtGoal)
+	{
+		if (!Seed.IsValid() || !Goal.IsValid() || Seed.Node == Goal.Node)
+		{
+			SetResolution(EPathfindingResolution::Fail);
+			return;
+		}
+
+		const int32 LeafIndex = bRootedAtGoal ? Seed.Node->Index : Goal.Node->Index;
+
+		int32 PathNodeIndex = PCGEx::NH64A(TravelStack->Get(LeafIndex));
+		int32 PathEdgeIndex = -1;
+
+		if (PathNodeIndex == -1)
+		{
+			SetResolution(EPathfindingResolution::Fail);
+			return;
+		}
+
+		AddPathNode(LeafIndex);
+
+		while (PathNodeIndex != -1)
+		{
+			const int32 CurrentIndex = PathNodeIndex;
+			PCGEx::NH64(TravelStack->Get(CurrentIndex), PathNodeIndex, PathEdgeIndex);
+
+			AddPathNode(CurrentIndex, PathEdgeIndex);
+		}
+
+		// Path must be goal-to-seed before resolution
+		if (bRootedAtGoal)
+		{
+			Algo::Reverse(PathNodes);
+			Algo::Reverse(PathEdges);
+		}
+
+		SetResolution(HasValidPathPoints() ? EPathfindingResolution::Success : EPathfindingResolution::Fail);
+	}
+
 	void FPathQuery::AppendNodePoints(
 		TArray<int32>& OutPoints,
 		const int32 TruncateStart,
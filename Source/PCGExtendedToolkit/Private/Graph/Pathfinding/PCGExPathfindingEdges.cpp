@@ -239,6 +239,36 @@ namespace PCGExPathfindingEdges
 			Queries[i] = Query;
 		}
 
+		EPCGExPathfindingBatching Batching = Settings->Batching;
+		if (Batching != EPCGExPathfindingBatching::None && (HeuristicsHandler->HasAnyFeedback() || !HeuristicsHandler->IsGoalAgnostic()))
+		{
+			// Scores would differ from one goal to another, or from one query to the next
+			Batching = EPCGExPathfindingBatching::None;
+		}
+
+		if (Batching != EPCGExPathfindingBatching::None)
+		{
+			PCGEX_ASYNC_GROUP_CHKD(AsyncManager, ResolvePicksTask)
+
+			ResolvePicksTask->OnCompleteCallback =
+				[PCGEX_ASYNC_THIS_CAPTURE, Batching]()
+				{
+					PCGEX_ASYNC_THIS
+					if (Batching == EPCGExPathfindingBatching::Grouped) { This->StartGroupedSearches(); }
+					else { This->StartNearestSeedSearch(); }
+				};
+
+			ResolvePicksTask->OnIterationCallback =
+				[PCGEX_ASYNC_THIS_CAPTURE](const int32 Index, const PCGExMT::FScope& Scope)
+				{
+					PCGEX_ASYNC_THIS
+					This->Queries[Index]->ResolvePicks(This->Settings->SeedPicking, This->Settings->GoalPicking);
+				};
+
+			ResolvePicksTask->StartIterations(Queries.Num(), 64);
+			return true;
+		}
+
 		PCGEX_ASYNC_GROUP_CHKD(AsyncManager, ResolveQueriesTask)
 		ResolveQueriesTask->OnIterationCallback =
 			[PCGEX_ASYNC_THIS_CAPTURE](const int32 Index, const PCGExMT::FScope& Scope)
@@ -261,6 +291,153 @@ namespace PCGExPathfindingEdges
 		ResolveQueriesTask->StartIterations(Queries.Num(), 1, HeuristicsHandler->HasGlobalFeedback());
 		return true;
 	}
+
+	void FProcessor::StartGroupedSearches()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExPathfindingEdges::StartGroupedSearches);
+
+		// Group queries by seed node and by goal node, and expand from whichever side requires fewer searches.
+		// Expanding from goals scores edges backward, which is only valid if heuristics don't care about the path walked so far.
+
+		TMap<int32, int32> SeedGroupMap;
+		TMap<int32, int32> GoalGroupMap;
+		TArray<TArray<int32>> SeedGroups;
+		TArray<TArray<int32>> GoalGroups;
+
+		for (int i = 0; i < Queries.Num(); i++)
+		{
+			const TSharedPtr<PCGExPathfinding::FPathQuery>& Query = Queries[i];
+			if (!Query->HasValidEndpoints()) { continue; }
+
+			const int32* SeedGroup = SeedGroupMap.Find(Query->Seed.Node->Index);
+			if (!SeedGroup) { SeedGroup = &SeedGroupMap.Add(Query->Seed.Node->Index, SeedGroups.Emplace()); }
+			SeedGroups[*SeedGroup].Add(i);
+
+			const int32* GoalGroup = GoalGroupMap.Find(Query->Goal.Node->Index);
+			if (!GoalGroup) { GoalGroup = &GoalGroupMap.Add(Query->Goal.Node->Index, GoalGroups.Emplace()); }
+			GoalGroups[*GoalGroup].Add(i);
+		}
+
+		bReverseGroups = GoalGroups.Num() < SeedGroups.Num() && HeuristicsHandler->IsTravelAgnostic();
+		QueryGroups = MoveTemp(bReverseGroups ? GoalGroups : SeedGroups);
+
+		if (QueryGroups.IsEmpty()) { return; }
+
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, GroupedSearchTask)
+		GroupedSearchTask->OnIterationCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const int32 Index, const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+
+				const TArray<int32>& Group = This->QueryGroups[Index];
+				const bool bReverse = This->bReverseGroups;
+
+				const TSharedPtr<PCGExPathfinding::FPathQuery>& First = This->Queries[Group[0]];
+
+				TArray<int32> Roots;
+				Roots.Add(bReverse ? First->Goal.Node->Index : First->Seed.Node->Index);
+
+				TArray<int32> Targets;
+				Targets.Reserve(Group.Num());
+				for (const int32 QueryIndex : Group)
+				{
+					const TSharedPtr<PCGExPathfinding::FPathQuery>& Query = This->Queries[QueryIndex];
+					Targets.Add(bReverse ? Query->Seed.Node->Index : Query->Goal.Node->Index);
+				}
+
+				const TSharedPtr<PCGExSearch::FSearchAllocations> Allocations = This->SearchOperation->ExpandFrom(Roots, Targets, This->HeuristicsHandler, bReverse);
+				for (const int32 QueryIndex : Group) { This->ResolveQuery(This->Queries[QueryIndex], Allocations->TypedTravelStack, bReverse); }
+				This->SearchOperation->ReleaseAllocations(Allocations);
+			};
+
+		GroupedSearchTask->StartIterations(QueryGroups.Num(), 1);
+	}
+
+	void FProcessor::StartNearestSeedSearch()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExPathfindingEdges::StartNearestSeedSearch);
+
+		// One query per goal point; the seed is picked after the fact, from the root its path leads back to.
+
+		TMap<int32, int32> RootQueries;
+		TSet<int32> UniqueGoals;
+
+		TArray<int32> Roots;
+		TArray<int32> Targets;
+
+		QueryGroups.SetNum(1);
+		TArray<int32>& GoalQueries = QueryGroups[0];
+
+		for (int i = 0; i < Queries.Num(); i++)
+		{
+			const TSharedPtr<PCGExPathfinding::FPathQuery>& Query = Queries[i];
+
+			if (Query->Seed.IsValid() && !RootQueries.Contains(Query->Seed.Node->Index))
+			{
+				RootQueries.Add(Query->Seed.Node->Index, i);
+				Roots.Add(Query->Seed.Node->Index);
+			}
+
+			bool bAlreadySet = false;
+			if (Query->Goal.IsValid()) { UniqueGoals.Add(Query->Goal.Point.Index, &bAlreadySet); }
+			else { continue; }
+
+			if (bAlreadySet) { continue; }
+
+			GoalQueries.Add(i);
+			Targets.Add(Query->Goal.Node->Index);
+		}
+
+		if (Roots.IsEmpty() || GoalQueries.IsEmpty()) { return; }
+
+		SharedSearch = SearchOperation->ExpandFrom(Roots, Targets, HeuristicsHandler);
+
+		PCGEx::FHashLookupStamped* TravelStack = SharedSearch->TypedTravelStack;
+		for (const int32 QueryIndex : GoalQueries)
+		{
+			// Walk back to the root to find out which seed reached that goal first
+			const TSharedPtr<PCGExPathfinding::FPathQuery>& Query = Queries[QueryIndex];
+
+			int32 RootIndex = Query->Goal.Node->Index;
+			int32 PrevIndex = PCGEx::NH64A(TravelStack->Get(RootIndex));
+			while (PrevIndex != -1)
+			{
+				RootIndex = PrevIndex;
+				PrevIndex = PCGEx::NH64A(TravelStack->Get(RootIndex));
+			}
+
+			if (const int32* RootQuery = RootQueries.Find(RootIndex)) { Query->Seed = Queries[*RootQuery]->Seed; }
+		}
+
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, NearestSeedPathsTask)
+
+		NearestSeedPathsTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->SearchOperation->ReleaseAllocations(This->SharedSearch);
+				This->SharedSearch.Reset();
+			};
+
+		NearestSeedPathsTask->OnIterationCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const int32 Index, const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				This->ResolveQuery(This->Queries[This->QueryGroups[0][Index]], This->SharedSearch->TypedTravelStack, false);
+			};
+
+		NearestSeedPathsTask->StartIterations(GoalQueries.Num(), 32);
+	}
+
+	void FProcessor::ResolveQuery(const TSharedPtr<PCGExPathfinding::FPathQuery>& Query, PCGEx::FHashLookupStamped* TravelStack, const bool bRootedAtGoal) const
+	{
+		Query->FindPath(TravelStack, bRootedAtGoal);
+
+		if (!Query->IsQuerySuccessful()) { return; }
+
+		Context->BuildPath(Query);
+		Query->Cleanup();
+	}
 }
 
 
@@ -120,47 +120,35 @@ namespace PCGExFindAllCells
 		if (Settings->Constraints.bOmitWrappingBounds) { CellsConstraints->BuildWrapperCell(Cluster.ToSharedRef(), *ProjectedVtxPositions.Get()); }
 		CellsConstraints->Holes = Holes;
 
-		StartParallelLoopForEdges(32); // Might be overkill low
+		// Every half-edge borders exactly one face; enumerating faces visits each cell once, no de-duplication required.
+		HalfEdges = MakeShared<PCGExTopology::FHalfEdgeGraph>();
+		HalfEdges->Build(Cluster.ToSharedRef(), *ProjectedVtxPositions.Get());
+
+		if (CellsConstraints->WrapperCell)
+		{
+			const int32 WrapperHalfEdge = HalfEdges->FindHalfEdge(CellsConstraints->WrapperCell->Seed);
+			if (WrapperHalfEdge != -1) { WrapperFace = HalfEdges->Face[WrapperHalfEdge]; }
+		}
+
+		StartParallelLoopForRange(HalfEdges->NumFaces(), 32);
 
 		return true;
 	}
 
-	void FProcessor::ProcessEdges(const PCGExMT::FScope& Scope)
+	void FProcessor::ProcessRange(const PCGExMT::FScope& Scope)
 	{
-		TArray<PCGExGraph::FEdge>& ClusterEdges = *Cluster->Edges;
+		const TArray<FVector2D>& ProjectedPositions = *ProjectedVtxPositions.Get();
 
 		PCGEX_SCOPE_LOOP(Index)
 		{
-			PCGExGraph::FEdge& Edge = ClusterEdges[Index];
+			if (Index == WrapperFace) { continue; }
 
-			//Check endpoints
-			FindCell(*Cluster->GetEdgeStart(Edge), Edge);
-			FindCell(*Cluster->GetEdgeEnd(Edge), Edge);
-		}
-	}
+			const TSharedPtr<PCGExTopology::FCell> Cell = MakeShared<PCGExTopology::FCell>(CellsConstraints.ToSharedRef());
+			const PCGExTopology::ECellResult Result = Cell->BuildFromFace(*HalfEdges.Get(), Index, Cluster.ToSharedRef(), ProjectedPositions);
+			if (Result != PCGExTopology::ECellResult::Success) { continue; }
 
-	bool FProcessor::FindCell(
-		const PCGExCluster::FNode& Node,
-		const PCGExGraph::FEdge& Edge,
-		const bool bSkipBinary)
-	{
-		if (Node.IsBinary() && bSkipBinary)
-		{
-			FPlatformAtomics::InterlockedExchange(&LastBinary, Node.Index);
-			return false;
+			ProcessCell(Cell);
 		}
-
-		if (!CellsConstraints->bKeepCellsWithLeaves && Node.IsLeaf()) { return false; }
-
-		FPlatformAtomics::InterlockedAdd(&NumAttempts, 1);
-		const TSharedPtr<PCGExTopology::FCell> Cell = MakeShared<PCGExTopology::FCell>(CellsConstraints.ToSharedRef());
-
-		const PCGExTopology::ECellResult Result = Cell->BuildFromCluster(PCGExGraph::FLink(Node.Index, Edge.Index), Cluster.ToSharedRef(), *ProjectedVtxPositions.Get());
-		if (Result != PCGExTopology::ECellResult::Success) { return false; }
-
-		ProcessCell(Cell);
-
-		return true;
 	}
 
 	void FProcessor::ProcessCell(const TSharedPtr<PCGExTopology::FCell>& InCell)
@@ -190,22 +178,6 @@ namespace PCGExFindAllCells
 		FPlatformAtomics::InterlockedIncrement(&OutputPathsNum);
 	}
 
-	void FProcessor::EnsureRoamingClosedLoopProcessing()
-	{
-		if (NumAttempts == 0 && LastBinary != -1)
-		{
-			PCGEX_MAKE_SHARED(Cell, PCGExTopology::FCell, CellsConstraints.ToSharedRef())
-			PCGExGraph::FEdge& Edge = *Cluster->GetEdge(Cluster->GetNode(LastBinary)->Links[0].Edge);
-			FindCell(*Cluster->GetEdgeStart(Edge), Edge, false);
-		}
-	}
-
-	void FProcessor::OnEdgesProcessingComplete()
-	{
-		EnsureRoamingClosedLoopProcessing();
-		TProcessor<FPCGExFindAllCellsContext, UPCGExFindAllCellsSettings>::OnEdgesProcessingComplete();
-	}
-
 	void FProcessor::CompleteWork()
 	{
 		if (!CellsConstraints->WrapperCell) { return; }
@@ -216,6 +188,7 @@ namespace PCGExFindAllCells
 	{
 		TProcessor<FPCGExFindAllCellsContext, UPCGExFindAllCellsSettings>::Cleanup();
 		CellsConstraints->Cleanup();
+		HalfEdges.Reset();
 	}
 }
 
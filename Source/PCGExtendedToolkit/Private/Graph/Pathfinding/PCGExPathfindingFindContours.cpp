@@ -60,10 +60,12 @@ bool FPCGExFindContoursElement::Boot(FPCGExContext* InContext) const
 
 		Context->GoodSeeds = NewPointIO(Context->SeedsDataFacade->Source, PCGExFindContours::OutputGoodSeedsLabel);
 		Context->GoodSeeds->InitializeOutput(PCGExData::EIOInit::Duplicate);
+		Context->GoodSeeds->MaterializeOutput();
 		PCGEx::SetNumPointsAllocated(Context->GoodSeeds->GetOut(), NumSeeds);
 
 		Context->BadSeeds = NewPointIO(Context->SeedsDataFacade->Source, PCGExFindContours::OutputBadSeedsLabel);
 		Context->BadSeeds->InitializeOutput(PCGExData::EIOInit::Duplicate);
+		Context->BadSeeds->MaterializeOutput();
 		PCGEx::SetNumPointsAllocated(Context->BadSeeds->GetOut(), NumSeeds);
 	}
 
@@ -25,18 +25,16 @@ bool FPCGExSearchOperationAStar::ResolveQuery(
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(UPCGExSearchAStar::FindPath);
 
-	TBitArray<> Visited;
-	Visited.Init(false, NumNodes);
+	const TSharedPtr<PCGExSearch::FSearchAllocations> Allocations = AcquireAllocations();
+	check(Allocations->GetNumNodes() == NumNodes)
 
-	const TSharedPtr<PCGEx::FHashLookup> TravelStack = PCGEx::NewHashLookup<PCGEx::FHashLookupArray>(PCGEx::NH64(-1, -1), NumNodes);
+	PCGEx::TStampedArray<bool>& Visited = Allocations->Visited;
+	PCGEx::TStampedArray<double>& GScore = Allocations->GScore;
+	PCGEx::FHashLookupStamped* TravelStack = Allocations->TypedTravelStack;
+	PCGExSearch::FScoredQueue* ScoredQueue = Allocations->ScoredQueue.Get();
 
-	TArray<double> GScore;
-	GScore.Init(-1, NumNodes);
-
-	const TUniquePtr<PCGExSearch::FScoredQueue> ScoredQueue = MakeUnique<PCGExSearch::FScoredQueue>(
-		NumNodes, SeedNode.Index, Heuristics->GetGlobalScore(SeedNode, SeedNode, GoalNode));
-
-	GScore[SeedNode.Index] = 0;
+	ScoredQueue->Reset(SeedNode.Index, Heuristics->GetGlobalScore(SeedNode, SeedNode, GoalNode));
+	GScore.Set(SeedNode.Index, 0);
 
 	const PCGExHeuristics::FLocalFeedbackHandler* Feedback = LocalFeedback.Get();
 
@@ -47,31 +45,31 @@ bool FPCGExSearchOperationAStar::ResolveQuery(
 	{
 		if (bEarlyExit && CurrentNodeIndex == GoalNode.Index) { break; } // Exit early
 
-		const double CurrentGScore = GScore[CurrentNodeIndex];
+		const double CurrentGScore = GScore.Get(CurrentNodeIndex);
 		const PCGExCluster::FNode& Current = NodesRef[CurrentNodeIndex];
 
-		if (Visited[CurrentNodeIndex]) { continue; }
-		Visited[CurrentNodeIndex] = true;
+		if (Visited.Get(CurrentNodeIndex)) { continue; }
+		Visited.Set(CurrentNodeIndex, true);
 		VisitedNum++;
 
-		for (const PCGExGraph::FLink Lk : Current.Links)
+		for (const PCGExGraph::FLink Lk : Cluster->GetLinks(CurrentNodeIndex))
 		{
 			const uint32 NeighborIndex = Lk.Node;
 			const uint32 EdgeIndex = Lk.Edge;
 
-			if (Visited[NeighborIndex]) { continue; }
+			if (Visited.Get(NeighborIndex)) { continue; }
 
 			const PCGExCluster::FNode& AdjacentNode = NodesRef[NeighborIndex];
 			const PCGExGraph::FEdge& Edge = EdgesRef[EdgeIndex];
 
-			const double EScore = Heuristics->GetEdgeScore(Current, AdjacentNode, Edge, SeedNode, GoalNode, Feedback, TravelStack);
+			const double EScore = Heuristics->GetEdgeScore(Current, AdjacentNode, Edge, SeedNode, GoalNode, Feedback, Allocations->TravelStack);
 			const double TentativeGScore = CurrentGScore + EScore;
 
-			const double PreviousGScore = GScore[NeighborIndex];
+			const double PreviousGScore = GScore.Get(NeighborIndex);
 			if (PreviousGScore != -1 && TentativeGScore >= PreviousGScore) { continue; }
 
 			TravelStack->Set(NeighborIndex, PCGEx::NH64(CurrentNodeIndex, EdgeIndex));
-			GScore[NeighborIndex] = TentativeGScore;
+			GScore.Set(NeighborIndex, TentativeGScore);
 
 			const double GS = Heuristics->GetGlobalScore(AdjacentNode, SeedNode, GoalNode, Feedback);
 			const double FScore = TentativeGScore + GS * Heuristics->ReferenceWeight;
@@ -101,5 +99,7 @@ bool FPCGExSearchOperationAStar::ResolveQuery(
 		}
 	}
 
+	ReleaseAllocations(Allocations);
+
 	return bSuccess;
 }
@@ -0,0 +1,169 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+
+#include "Graph/Pathfinding/Search/PCGExSearchBidirectionalAStar.h"
+
+#include "Graph/PCGExCluster.h"
+#include "Graph/Pathfinding/Heuristics/PCGExHeuristics.h"
+#include "Graph/Pathfinding/Search/PCGExScoredQueue.h"
+
+bool FPCGExSearchOperationBidirectionalAStar::ResolveQuery(
+	const TSharedPtr<PCGExPathfinding::FPathQuery>& InQuery,
+	const TSharedPtr<PCGExHeuristics::FHeuristicsHandler>& Heuristics,
+	const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback) const
+{
+	// The backward frontier has no travel history to offer, fall back to the regular search.
+	if (!Heuristics->IsTravelAgnostic()) { return FPCGExSearchOperationAStar::ResolveQuery(InQuery, Heuristics, LocalFeedback); }
+
+	check(InQuery->PickResolution == PCGExPathfinding::EQueryPickResolution::Success)
+
+	const TArray<PCGExCluster::FNode>& NodesRef = *Cluster->Nodes;
+	const TArray<PCGExGraph::FEdge>& EdgesRef = *Cluster->Edges;
+
+	const PCGExCluster::FNode& SeedNode = *InQuery->Seed.Node;
+	const PCGExCluster::FNode& GoalNode = *InQuery->Goal.Node;
+
+	const int32 NumNodes = NodesRef.Num();
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPCGExSearchBidirectionalAStar::FindPath);
+
+	const PCGExHeuristics::FLocalFeedbackHandler* Feedback = LocalFeedback.Get();
+
+	// Average potential : keeps both frontiers consistent with each other,
+	// so we can stop as soon as the sum of their smallest keys reaches the best meeting cost.
+	auto GetPotential = [&](const PCGExCluster::FNode& Node)
+	{
+		return 0.5 * Heuristics->ReferenceWeight * (
+			Heuristics->GetGlobalScore(Node, SeedNode, GoalNode, Feedback) -
+			Heuristics->GetGlobalScore(Node, GoalNode, SeedNode, Feedback));
+	};
+
+	const TSharedPtr<PCGExSearch::FSearchAllocations> Allocations[2] = {AcquireAllocations(), AcquireAllocations()};
+	check(Allocations[0]->GetNumNodes() == NumNodes)
+	check(Allocations[1]->GetNumNodes() == NumNodes)
+
+	Allocations[0]->ScoredQueue->Reset(SeedNode.Index, GetPotential(SeedNode));
+	Allocations[0]->GScore.Set(SeedNode.Index, 0);
+
+	Allocations[1]->ScoredQueue->Reset(GoalNode.Index, -GetPotential(GoalNode));
+	Allocations[1]->GScore.Set(GoalNode.Index, 0);
+
+	double BestCost = MAX_dbl;
+	int32 MeetFrom = -1; // Last node of the forward half
+	int32 MeetTo = -1;   // First node of the backward half
+	int32 MeetEdge = -1;
+
+	// Last key dequeued on each side; never greater than what's left in that queue
+	double TopKey[2] = {-MAX_dbl, -MAX_dbl};
+	bool bExhausted[2] = {false, false};
+
+	int32 Side = 1;
+	while (!bExhausted[0] || !bExhausted[1])
+	{
+		Side = bExhausted[1 - Side] ? Side : 1 - Side;
+
+		const int32 Other = 1 - Side;
+		const bool bForward = Side == 0;
+
+		PCGExSearch::FSearchAllocations* This = Allocations[Side].Get();
+		PCGExSearch::FSearchAllocations* That = Allocations[Other].Get();
+
+		int32 CurrentNodeIndex;
+		double CurrentKey;
+		if (!This->ScoredQueue->Dequeue(CurrentNodeIndex, CurrentKey))
+		{
+			bExhausted[Side] = true;
+			continue;
+		}
+
+		TopKey[Side] = CurrentKey;
+		if (BestCost != MAX_dbl && TopKey[0] + TopKey[1] >= BestCost) { break; } // Frontiers can't improve on the best meeting anymore
+
+		if (This->Visited.Get(CurrentNodeIndex)) { continue; }
+		This->Visited.Set(CurrentNodeIndex, true);
+
+		const double CurrentGScore = This->GScore.Get(CurrentNodeIndex);
+		const PCGExCluster::FNode& Current = NodesRef[CurrentNodeIndex];
+
+		for (const PCGExGraph::FLink Lk : Cluster->GetLinks(CurrentNodeIndex))
+		{
+			const uint32 NeighborIndex = Lk.Node;
+			const uint32 EdgeIndex = Lk.Edge;
+
+			const PCGExCluster::FNode& AdjacentNode = NodesRef[NeighborIndex];
+			const PCGExGraph::FEdge& Edge = EdgesRef[EdgeIndex];
+
+			// Backward frontier walks edges against the direction they'll be travelled in
+			const double EScore = bForward ?
+				                      Heuristics->GetEdgeScore(Current, AdjacentNode, Edge, SeedNode, GoalNode, Feedback, This->TravelStack) :
+				                      Heuristics->GetEdgeScore(AdjacentNode, Current, Edge, SeedNode, GoalNode, Feedback, This->TravelStack);
+
+			const double TentativeGScore = CurrentGScore + EScore;
+
+			const double OtherGScore = That->GScore.Get(NeighborIndex);
+			if (OtherGScore != -1 && TentativeGScore + OtherGScore < BestCost)
+			{
+				BestCost = TentativeGScore + OtherGScore;
+				MeetFrom = bForward ? CurrentNodeIndex : NeighborIndex;
+				MeetTo = bForward ? NeighborIndex : CurrentNodeIndex;
+				MeetEdge = EdgeIndex;
+			}
+
+			if (This->Visited.Get(NeighborIndex)) { continue; }
+
+			const double PreviousGScore = This->GScore.Get(NeighborIndex);
+			if (PreviousGScore != -1 && TentativeGScore >= PreviousGScore) { continue; }
+
+			This->TypedTravelStack->Set(NeighborIndex, PCGEx::NH64(CurrentNodeIndex, EdgeIndex));
+			This->GScore.Set(NeighborIndex, TentativeGScore);
+
+			const double Potential = GetPotential(AdjacentNode);
+			This->ScoredQueue->Enqueue(NeighborIndex, TentativeGScore + (bForward ? Potential : -Potential));
+		}
+	}
+
+	bool bSuccess = false;
+
+	if (MeetEdge != -1)
+	{
+		bSuccess = true;
+
+		// Path is expected goal-to-seed, it gets reversed once resolved.
+		// Unwind the backward half first (meet -> goal), then emit it in reverse.
+
+		PCGEx::FHashLookupStamped* BackwardStack = Allocations[1]->TypedTravelStack;
+		PCGEx::FHashLookupStamped* ForwardStack = Allocations[0]->TypedTravelStack;
+
+		TArray<int32> BackwardNodes;
+		TArray<int32> BackwardEdges;
+
+		int32 PathNodeIndex = MeetTo;
+		int32 PathEdgeIndex = -1;
+
+		BackwardNodes.Add(PathNodeIndex);
+		while (PCGEx::NH64A(BackwardStack->Get(PathNodeIndex)) != -1)
+		{
+			PCGEx::NH64(BackwardStack->Get(PathNodeIndex), PathNodeIndex, PathEdgeIndex);
+			BackwardNodes.Add(PathNodeIndex);
+			BackwardEdges.Add(PathEdgeIndex);
+		}
+
+		InQuery->AddPathNode(BackwardNodes.Last());
+		for (int i = BackwardEdges.Num() - 1; i >= 0; i--) { InQuery->AddPathNode(BackwardNodes[i], BackwardEdges[i]); }
+
+		PathNodeIndex = MeetFrom;
+		InQuery->AddPathNode(PathNodeIndex, MeetEdge);
+
+		while (PCGEx::NH64A(ForwardStack->Get(PathNodeIndex)) != -1)
+		{
+			PCGEx::NH64(ForwardStack->Get(PathNodeIndex), PathNodeIndex, PathEdgeIndex);
+			InQuery->AddPathNode(PathNodeIndex, PathEdgeIndex);
+		}
+	}
+
+	ReleaseAllocations(Allocations[0]);
+	ReleaseAllocations(Allocations[1]);
+
+	return bSuccess;
+}
@@ -26,13 +26,14 @@ bool FPCGExSearchOperationDijkstra::ResolveQuery(
 
 	// Basic Dijkstra implementation
 
-	TBitArray<> Visited;
-	Visited.Init(false, NumNodes);
+	const TSharedPtr<PCGExSearch::FSearchAllocations> Allocations = AcquireAllocations();
+	check(Allocations->GetNumNodes() == NumNodes)
 
-	const TSharedPtr<PCGEx::FHashLookup> TravelStack = PCGEx::NewHashLookup<PCGEx::FHashLookupArray>(PCGEx::NH64(-1, -1), NumNodes);
+	PCGEx::TStampedArray<bool>& Visited = Allocations->Visited;
+	PCGEx::FHashLookupStamped* TravelStack = Allocations->TypedTravelStack;
+	PCGExSearch::FScoredQueue* ScoredQueue = Allocations->ScoredQueue.Get();
 
-	const TUniquePtr<PCGExSearch::FScoredQueue> ScoredQueue = MakeUnique<PCGExSearch::FScoredQueue>(
-		NumNodes, SeedNode.Index, 0);
+	ScoredQueue->Reset(SeedNode.Index, 0);
 
 	const PCGExHeuristics::FLocalFeedbackHandler* Feedback = LocalFeedback.Get();
 
@@ -45,21 +46,21 @@ bool FPCGExSearchOperationDijkstra::ResolveQuery(
 
 		const PCGExCluster::FNode& Current = NodesRef[CurrentNodeIndex];
 
-		if (Visited[CurrentNodeIndex]) { continue; }
-		Visited[CurrentNodeIndex] = true;
+		if (Visited.Get(CurrentNodeIndex)) { continue; }
+		Visited.Set(CurrentNodeIndex, true);
 		VisitedNum++;
 
-		for (const PCGExGraph::FLink Lk : Current.Links)
+		for (const PCGExGraph::FLink Lk : Cluster->GetLinks(CurrentNodeIndex))
 		{
 			const uint32 NeighborIndex = Lk.Node;
 			const uint32 EdgeIndex = Lk.Edge;
 
-			if (Visited[NeighborIndex]) { continue; }
+			if (Visited.Get(NeighborIndex)) { continue; }
 
 			const PCGExCluster::FNode& AdjacentNode = NodesRef[NeighborIndex];
 			const PCGExGraph::FEdge& Edge = EdgesRef[EdgeIndex];
 
-			const double AltScore = CurrentScore + Heuristics->GetEdgeScore(Current, AdjacentNode, Edge, SeedNode, GoalNode, Feedback, TravelStack);
+			const double AltScore = CurrentScore + Heuristics->GetEdgeScore(Current, AdjacentNode, Edge, SeedNode, GoalNode, Feedback, Allocations->TravelStack);
 			if (ScoredQueue->Enqueue(NeighborIndex, AltScore))
 			{
 				TravelStack->Set(NeighborIndex, PCGEx::NH64(CurrentNodeIndex, EdgeIndex));
@@ -88,5 +89,7 @@ bool FPCGExSearchOperationDijkstra::ResolveQuery(
 		}
 	}
 
+	ReleaseAllocations(Allocations);
+
 	return bSuccess;
 }
@@ -4,9 +4,138 @@
 
 #include "Graph/Pathfinding/Search/PCGExSearchOperation.h"
 
+namespace PCGExSearch
+{
+	FSearchAllocations::FSearchAllocations(const int32 InNumNodes)
+		: NumNodes(InNumNodes)
+	{
+		Visited.Init(false, NumNodes);
+		GScore.Init(-1, NumNodes);
+
+		const TSharedPtr<PCGEx::FHashLookupStamped> TypedStack = MakeShared<PCGEx::FHashLookupStamped>(PCGEx::NH64(-1, -1), NumNodes);
+		TypedTravelStack = TypedStack.Get();
+		TravelStack = TypedStack;
+
+		ScoredQueue = MakeUnique<FScoredQueue>(NumNodes);
+	}
+
+	void FSearchAllocations::Reset()
+	{
+		Visited.Reset();
+		GScore.Reset();
+		TypedTravelStack->Reset();
+	}
+}
+
 void FPCGExSearchOperation::PrepareForCluster(PCGExCluster::FCluster* InCluster)
 {
 	Cluster = InCluster;
+
+	FWriteScopeLock WriteScopeLock(PoolLock);
+	AllocationsPool.Empty();
+}
+
+TSharedPtr<PCGExSearch::FSearchAllocations> FPCGExSearchOperation::AcquireAllocations() const
+{
+	{
+		FWriteScopeLock WriteScopeLock(PoolLock);
+		if (!AllocationsPool.IsEmpty())
+		{
+			TSharedPtr<PCGExSearch::FSearchAllocations> Allocations = AllocationsPool.Pop(EAllowShrinking::No);
+			Allocations->Reset();
+			return Allocations;
+		}
+	}
+
+	return MakeShared<PCGExSearch::FSearchAllocations>(Cluster->Nodes->Num());
+}
+
+void FPCGExSearchOperation::ReleaseAllocations(const TSharedPtr<PCGExSearch::FSearchAllocations>& InAllocations) const
+{
+	if (!InAllocations || InAllocations->GetNumNodes() != Cluster->Nodes->Num()) { return; }
+
+	FWriteScopeLock WriteScopeLock(PoolLock);
+	AllocationsPool.Add(InAllocations);
+}
+
+TSharedPtr<PCGExSearch::FSearchAllocations> FPCGExSearchOperation::ExpandFrom(
+	const TArray<int32>& Roots,
+	const TArray<int32>& Targets,
+	const TSharedPtr<PCGExHeuristics::FHeuristicsHandler>& Heuristics,
+	const bool bReverse) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExSearchOperation::ExpandFrom);
+
+	check(!Roots.IsEmpty())
+
+	const TArray<PCGExCluster::FNode>& NodesRef = *Cluster->Nodes;
+	const TArray<PCGExGraph::FEdge>& EdgesRef = *Cluster->Edges;
+
+	const int32 NumNodes = NodesRef.Num();
+
+	const TSharedPtr<PCGExSearch::FSearchAllocations> Allocations = AcquireAllocations();
+	check(Allocations->GetNumNodes() == NumNodes)
+
+	PCGEx::TStampedArray<bool>& Visited = Allocations->Visited;
+	PCGEx::FHashLookupStamped* TravelStack = Allocations->TypedTravelStack;
+	PCGExSearch::FScoredQueue* ScoredQueue = Allocations->ScoredQueue.Get();
+
+	ScoredQueue->Reset(Roots[0], 0);
+	for (int i = 1; i < Roots.Num(); i++) { ScoredQueue->Enqueue(Roots[i], 0); }
+
+	TBitArray<> IsTarget;
+	int32 RemainingTargets = 0;
+
+	if (!Targets.IsEmpty())
+	{
+		IsTarget.Init(false, NumNodes);
+		for (const int32 Target : Targets)
+		{
+			if (IsTarget[Target]) { continue; }
+			IsTarget[Target] = true;
+			RemainingTargets++;
+		}
+	}
+
+	// Heuristics are goal-agnostic here; roots only stand in for seed & goal
+	const PCGExCluster::FNode& RootNode = NodesRef[Roots[0]];
+
+	int32 CurrentNodeIndex;
+	double CurrentScore;
+	while (ScoredQueue->Dequeue(CurrentNodeIndex, CurrentScore))
+	{
+		if (Visited.Get(CurrentNodeIndex)) { continue; }
+		Visited.Set(CurrentNodeIndex, true);
+
+		if (RemainingTargets > 0 && IsTarget[CurrentNodeIndex])
+		{
+			if (--RemainingTargets == 0 && bEarlyExit) { break; } // Every target settled
+		}
+
+		const PCGExCluster::FNode& Current = NodesRef[CurrentNodeIndex];
+
+		for (const PCGExGraph::FLink Lk : Cluster->GetLinks(CurrentNodeIndex))
+		{
+			const uint32 NeighborIndex = Lk.Node;
+			const uint32 EdgeIndex = Lk.Edge;
+
+			if (Visited.Get(NeighborIndex)) { continue; }
+
+			const PCGExCluster::FNode& AdjacentNode = NodesRef[NeighborIndex];
+			const PCGExGraph::FEdge& Edge = EdgesRef[EdgeIndex];
+
+			const double EScore = bReverse ?
+				                      Heuristics->GetEdgeScore(AdjacentNode, Current, Edge, RootNode, RootNode) :
+				                      Heuristics->GetEdgeScore(Current, AdjacentNode, Edge, RootNode, RootNode, nullptr, Allocations->TravelStack);
+
+			if (ScoredQueue->Enqueue(NeighborIndex, CurrentScore + EScore))
+			{
+				TravelStack->Set(NeighborIndex, PCGEx::NH64(CurrentNodeIndex, EdgeIndex));
+			}
+		}
+	}
+
+	return Allocations;
 }
 
 bool FPCGExSearchOperation::ResolveQuery(
@@ -20,6 +20,13 @@ bool FPCGExProbeClosest::PrepareForPoints(FPCGExContext* InContext, const TShare
 	return true;
 }
 
+int32 FPCGExProbeClosest::GetMaxCandidates(const int32 Index) const
+{
+	// Coincidence prevention may skip any number of candidates, can't bound it
+	if (Config.bPreventCoincidence) { return -1; }
+	return FMath::Max(0, MaxConnections->Read(Index));
+}
+
 void FPCGExProbeClosest::ProcessCandidates(const int32 Index, const FTransform& WorkingTransform, TArray<PCGExProbing::FCandidate>& Candidates, TSet<FInt32Vector>* Coincidence, const FVector& ST, TSet<uint64>* OutEdges)
 {
 	bool bIsAlreadyConnected;
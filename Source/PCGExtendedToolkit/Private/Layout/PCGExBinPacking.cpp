@@ -318,7 +318,11 @@ namespace PCGExBinPacking
 		}
 
 		PCGEx::ArrayOfIndices(ProcessingOrder, PointDataFacade->GetNum());
-		if (Sorter && Sorter->Init(Context)) { ProcessingOrder.Sort([&](const int32& A, const int32& B) { return Sorter->Sort(A, B); }); }
+		if (Sorter && Sorter->Init(Context))
+		{
+			if (GetDefault<UPCGExGlobalSettings>()->bPrecomputeSortingKeys) { Sorter->BuildKeys(); }
+			Sorter->Sort(ProcessingOrder);
+		}
 
 		if (Settings->bAvoidWastedSpace)
 		{
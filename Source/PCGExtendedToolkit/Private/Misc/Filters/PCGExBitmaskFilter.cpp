@@ -63,6 +63,25 @@ bool PCGExPointFilter::FBitmaskFilter::Test(const int32 PointIndex) const
 	return TypedFilterFactory->Config.bInvertResult ? !Result : Result;
 }
 
+void PCGExPointFilter::FBitmaskFilter::TestRange(const PCGExMT::FScope& Scope, TArrayView<int8> InOutMask) const
+{
+	TArray<int64> Flags;
+	TArray<int64> Masks;
+	TArray<int8> Results;
+
+	Flags.SetNumUninitialized(Scope.Count);
+	Masks.SetNumUninitialized(Scope.Count);
+	Results.SetNumUninitialized(Scope.Count);
+
+	FlagsReader->ReadScope(Scope, Flags);
+	MaskReader->ReadScope(Scope, Masks);
+
+	PCGExCompare::CompareRange(TypedFilterFactory->Config.Comparison, Flags, Masks, Results);
+
+	const int8 Invert = TypedFilterFactory->Config.bInvertResult;
+	for (int i = 0; i < Scope.Count; i++) { InOutMask[i] &= Results[i] ^ Invert; }
+}
+
 bool PCGExPointFilter::FBitmaskFilter::Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const
 {
 	int64 OutFlags = 0;
@@ -153,6 +153,11 @@ if(TypedFilterFactory->Config.bInvert){\
 
 bool PCGExPointFilter::FBoundsFilter::Test(const int32 PointIndex) const { return BoundCheck(PointDataFacade->Source->GetInPoint(PointIndex)); }
 
+void PCGExPointFilter::FBoundsFilter::TestRange(const PCGExMT::FScope& Scope, TArrayView<int8> InOutMask) const
+{
+	for (int i = 0; i < Scope.Count; i++) { if (InOutMask[i]) { InOutMask[i] = BoundCheck(PointDataFacade->Source->GetInPoint(Scope.Start + i)); } }
+}
+
 bool PCGExPointFilter::FBoundsFilter::Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const
 {
 	PCGExData::FProxyPoint ProxyPoint;
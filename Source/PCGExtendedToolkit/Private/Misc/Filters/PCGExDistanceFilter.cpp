@@ -97,6 +97,35 @@ bool PCGExPointFilter::FDistanceFilter::Test(const int32 PointIndex) const
 	return PCGExCompare::Compare(TypedFilterFactory->Config.Comparison, FMath::Sqrt(BestDist), B, TypedFilterFactory->Config.Tolerance);
 }
 
+void PCGExPointFilter::FDistanceFilter::TestRange(const PCGExMT::FScope& Scope, TArrayView<int8> InOutMask) const
+{
+	if (bCheckAgainstDataBounds)
+	{
+		if (!bCollectionTestResult) { FMemory::Memzero(InOutMask.GetData(), Scope.Count); }
+		return;
+	}
+
+	TArray<double> Thresholds;
+	Thresholds.SetNumUninitialized(Scope.Count);
+	DistanceThresholdGetter->ReadScope(Scope, Thresholds);
+
+	const EPCGExComparison Comparison = TypedFilterFactory->Config.Comparison;
+	const double Tolerance = TypedFilterFactory->Config.Tolerance;
+
+	PCGExData::FConstPoint TargetPt;
+
+	// Nearest-target queries dominate; only run them on lanes that are still alive
+	for (int i = 0; i < Scope.Count; i++)
+	{
+		if (!InOutMask[i]) { continue; }
+
+		double BestDist = MAX_dbl;
+		TargetsHandler->FindClosestTarget(PointDataFacade->Source->GetInPoint(Scope.Start + i), TargetPt, BestDist, &IgnoreList);
+
+		InOutMask[i] = PCGExCompare::Compare(Comparison, FMath::Sqrt(BestDist), Thresholds[i], Tolerance);
+	}
+}
+
 bool PCGExPointFilter::FDistanceFilter::Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const
 {
 	PCGExData::FProxyPoint ProxyPoint;
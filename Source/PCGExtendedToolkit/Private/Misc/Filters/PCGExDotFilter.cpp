@@ -86,6 +86,36 @@ bool PCGExPointFilter::FDotFilter::Test(const int32 PointIndex) const
 		PointIndex);
 }
 
+void PCGExPointFilter::FDotFilter::TestRange(const PCGExMT::FScope& Scope, TArrayView<int8> InOutMask) const
+{
+	TArray<FVector> A;
+	TArray<FVector> B;
+
+	A.SetNumUninitialized(Scope.Count);
+	B.SetNumUninitialized(Scope.Count);
+
+	OperandA->ReadScope(Scope, A);
+	OperandB->ReadScope(Scope, B);
+
+	const bool bTransformA = TypedFilterFactory->Config.bTransformOperandA;
+	const bool bTransformB = TypedFilterFactory->Config.bTransformOperandB;
+
+	for (int i = 0; i < Scope.Count; i++)
+	{
+		if (!InOutMask[i]) { continue; }
+
+		const int32 PointIndex = Scope.Start + i;
+		const FVector VA = A[i] * OperandAMultiplier;
+		const FVector VB = B[i].GetSafeNormal() * OperandBMultiplier;
+
+		InOutMask[i] = DotComparison.Test(
+			FVector::DotProduct(
+				bTransformA ? InTransforms[PointIndex].TransformVectorNoScale(VA) : VA,
+				bTransformB ? InTransforms[PointIndex].TransformVectorNoScale(VB) : VB),
+			PointIndex);
+	}
+}
+
 bool PCGExPointFilter::FDotFilter::Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const
 {
 	PCGEX_SHARED_CONTEXT(IO->GetContextHandle())
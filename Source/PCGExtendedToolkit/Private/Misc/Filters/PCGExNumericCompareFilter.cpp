@@ -65,6 +65,23 @@ bool PCGExPointFilter::FNumericCompareFilter::Test(const int32 PointIndex) const
 	return PCGExCompare::Compare(TypedFilterFactory->Config.Comparison, A, B, TypedFilterFactory->Config.Tolerance);
 }
 
+void PCGExPointFilter::FNumericCompareFilter::TestRange(const PCGExMT::FScope& Scope, TArrayView<int8> InOutMask) const
+{
+	TArray<double> A;
+	TArray<double> B;
+	TArray<int8> Results;
+
+	A.SetNumUninitialized(Scope.Count);
+	B.SetNumUninitialized(Scope.Count);
+	Results.SetNumUninitialized(Scope.Count);
+
+	OperandA->ReadScope(Scope, A);
+	OperandB->ReadScope(Scope, B);
+
+	PCGExCompare::CompareRange<double>(TypedFilterFactory->Config.Comparison, A, B, Results, TypedFilterFactory->Config.Tolerance);
+	for (int i = 0; i < Scope.Count; i++) { InOutMask[i] &= Results[i]; }
+}
+
 bool PCGExPointFilter::FNumericCompareFilter::Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const
 {
 	double A = 0;
@@ -119,6 +119,36 @@ bool PCGExPointFilter::FRandomFilter::Test(const int32 PointIndex) const
 	return TypedFilterFactory->Config.bInvertResult ? RandomValue <= LocalThreshold : RandomValue >= LocalThreshold;
 }
 
+void PCGExPointFilter::FRandomFilter::TestRange(const PCGExMT::FScope& Scope, TArrayView<int8> InOutMask) const
+{
+	TArray<double> Weights;
+	Weights.SetNumUninitialized(Scope.Count);
+	WeightBuffer->ReadScope(Scope, Weights);
+
+	TArray<double> Thresholds;
+	if (ThresholdBuffer)
+	{
+		Thresholds.SetNumUninitialized(Scope.Count);
+		ThresholdBuffer->ReadScope(Scope, Thresholds);
+		for (double& T : Thresholds) { T = (ThresholdOffset + T) / ThresholdRange; }
+	}
+	else
+	{
+		Thresholds.Init(Threshold, Scope.Count);
+	}
+
+	const bool bInvertResult = TypedFilterFactory->Config.bInvertResult;
+
+	for (int i = 0; i < Scope.Count; i++)
+	{
+		if (!InOutMask[i]) { continue; }
+
+		const int32 PointIndex = Scope.Start + i;
+		const float RandomValue = WeightCurve->Eval((FRandomStream(PCGExRandom::GetRandomStreamFromPoint(Seeds[PointIndex], RandomSeed)).GetFraction() * (WeightOffset + Weights[i])) / WeightRange);
+		InOutMask[i] = bInvertResult ? RandomValue <= Thresholds[i] : RandomValue >= Thresholds[i];
+	}
+}
+
 bool PCGExPointFilter::FRandomFilter::Test(const PCGExData::FProxyPoint& Point) const
 {
 	const float RandomValue = WeightCurve->Eval((FRandomStream(PCGExRandom::ComputeSpatialSeed(Point.GetLocation(), RandomSeedV)).GetFraction() * WeightRange) / WeightRange);
@@ -80,6 +80,24 @@ bool PCGExPointFilter::FWithinRangeFilter::Test(const int32 PointIndex) const
 	return bInvert;
 }
 
+void PCGExPointFilter::FWithinRangeFilter::TestRange(const PCGExMT::FScope& Scope, TArrayView<int8> InOutMask) const
+{
+	TArray<double> A;
+	TArray<int8> Within;
+
+	A.SetNumUninitialized(Scope.Count);
+	Within.Init(0, Scope.Count);
+
+	OperandA->ReadScope(Scope, A);
+
+	// One pass per range rather than one range loop per point
+	if (bInclusive) { for (const FPCGExPickerConstantRangeConfig& Range : Ranges) { for (int i = 0; i < Scope.Count; i++) { Within[i] |= Range.IsWithinInclusive(A[i]); } } }
+	else { for (const FPCGExPickerConstantRangeConfig& Range : Ranges) { for (int i = 0; i < Scope.Count; i++) { Within[i] |= Range.IsWithin(A[i]); } } }
+
+	const int8 Invert = bInvert;
+	for (int i = 0; i < Scope.Count; i++) { InOutMask[i] &= Within[i] ^ Invert; }
+}
+
 bool PCGExPointFilter::FWithinRangeFilter::Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const
 {
 	double A = 0;
@@ -58,6 +58,32 @@ void FPCGExOverlapScoresWeighting::Max(const FPCGExOverlapScoresWeighting& Other
 	DataScore = FMath::Max(DataScore, Other.DataScore);
 }
 
+bool FPCGExOverlapScoresWeighting::AnyScoreEquals(const FPCGExOverlapScoresWeighting& Other) const
+{
+	return OverlapCount == Other.OverlapCount ||
+		OverlapSubCount == Other.OverlapSubCount ||
+		OverlapVolume == Other.OverlapVolume ||
+		OverlapVolumeDensity == Other.OverlapVolumeDensity ||
+		NumPoints == Other.NumPoints ||
+		Volume == Other.Volume ||
+		VolumeDensity == Other.VolumeDensity ||
+		CustomTagScore == Other.CustomTagScore ||
+		DataScore == Other.DataScore;
+}
+
+bool FPCGExOverlapScoresWeighting::AllScoresEqual(const FPCGExOverlapScoresWeighting& Other) const
+{
+	return OverlapCount == Other.OverlapCount &&
+		OverlapSubCount == Other.OverlapSubCount &&
+		OverlapVolume == Other.OverlapVolume &&
+		OverlapVolumeDensity == Other.OverlapVolumeDensity &&
+		NumPoints == Other.NumPoints &&
+		Volume == Other.Volume &&
+		VolumeDensity == Other.VolumeDensity &&
+		CustomTagScore == Other.CustomTagScore &&
+		DataScore == Other.DataScore;
+}
+
 TSharedPtr<PCGExDiscardByOverlap::FOverlap> FPCGExDiscardByOverlapContext::RegisterOverlap(
 	PCGExDiscardByOverlap::FProcessor* InA,
 	PCGExDiscardByOverlap::FProcessor* InB,
@@ -90,8 +116,8 @@ void FPCGExDiscardByOverlapContext::Prune()
 {
 	PCGEX_SETTINGS_LOCAL(DiscardByOverlap)
 
-	TArray<PCGExDiscardByOverlap::FProcessor*> Remaining;
-	Remaining.Reserve(MainBatch->GetNumProcessors());
+	PCGExDiscardByOverlap::FPruningQueue Queue(Settings->Logic, &MaxScores);
+	Queue.Reserve(MainBatch->GetNumProcessors());
 
 	for (const TPair<PCGExData::FPointIO*, TSharedPtr<PCGExPointsMT::IProcessor>> Pair : SubProcessorMap)
 	{
@@ -100,45 +126,61 @@ void FPCGExDiscardByOverlapContext::Prune()
 
 		if (P->HasOverlaps())
 		{
-			Remaining.Add(P);
+			Queue.Add(P);
 			continue;
 		}
 
 		PCGEX_INIT_IO_VOID(P->PointDataFacade->Source, PCGExData::EIOInit::Forward)
 	}
 
-	UpdateMaxScores(Remaining);
+	UpdateMaxScores(Queue.GetProcessors());
+
+	// Weights are only computed once the first candidate has been pruned
+	bool bFullUpdate = true;
 
-	while (!Remaining.IsEmpty())
+	while (!Queue.IsEmpty())
 	{
-		// Sort remaining overlaps...
+		PCGExDiscardByOverlap::FProcessor* Candidate = Queue.Pop();
+
+		if (Candidate->HasOverlaps()) { Candidate->Prune(Queue); }
+		else { PCGEX_INIT_IO_VOID(Candidate->PointDataFacade->Source, PCGExData::EIOInit::Forward) }
 
-		switch (Settings->Logic)
+		if (!bFullUpdate)
 		{
-		default: case EPCGExOverlapPruningLogic::LowFirst:
-			Remaining.Sort(
-				[](const PCGExDiscardByOverlap::FProcessor& A, const PCGExDiscardByOverlap::FProcessor& B)
-				{
-					return A.Weight == B.Weight ? A.PointDataFacade->Source->IOIndex > B.PointDataFacade->Source->IOIndex : A.Weight > B.Weight;
-				});
-			break;
-		case EPCGExOverlapPruningLogic::HighFirst:
-			Remaining.Sort(
-				[](const PCGExDiscardByOverlap::FProcessor& A, const PCGExDiscardByOverlap::FProcessor& B)
-				{
-					return A.Weight == B.Weight ? A.PointDataFacade->Source->IOIndex > B.PointDataFacade->Source->IOIndex : A.Weight < B.Weight;
-				});
-			break;
-		}
+			bool bRecomputeMax = Queue.IsMaxScoresDirty();
 
-		PCGExDiscardByOverlap::FProcessor* Candidate = Remaining.Pop();
+			if (!bRecomputeMax)
+			{
+				// Some scores (i.e overlap volume density) may grow when overlaps are removed
+				FPCGExOverlapScoresWeighting GrownMaxScores = MaxScores;
+				for (const PCGExDiscardByOverlap::FProcessor* C : Queue.GetDirty()) { if (C->QueueIndex != -1) { GrownMaxScores.Max(C->RawScores); } }
+				bRecomputeMax = !GrownMaxScores.AllScoresEqual(MaxScores);
+			}
 
-		if (Candidate->HasOverlaps()) { Candidate->Prune(Remaining); }
-		else { PCGEX_INIT_IO_VOID(Candidate->PointDataFacade->Source, PCGExData::EIOInit::Forward) }
+			if (bRecomputeMax)
+			{
+				const FPCGExOverlapScoresWeighting PrevMaxScores = MaxScores;
+				UpdateMaxScores(Queue.GetProcessors());
+				bFullUpdate = !PrevMaxScores.AllScoresEqual(MaxScores);
+			}
+		}
 
-		UpdateMaxScores(Remaining);
+		if (bFullUpdate)
+		{
+			// Max scores changed, every weight is affected
+			UpdateMaxScores(Queue.GetProcessors());
+			for (PCGExDiscardByOverlap::FProcessor* C : Queue.GetProcessors()) { C->UpdateWeight(MaxScores); }
+			Queue.Heapify();
+			bFullUpdate = false;
+		}
+		else
+		{
+			// Only processors that lost overlaps need to be re-keyed
+			for (PCGExDiscardByOverlap::FProcessor* C : Queue.GetDirty()) { if (C->QueueIndex != -1) { C->UpdateWeight(MaxScores); } }
+			Queue.UpdateDirty();
+		}
 
-		for (PCGExDiscardByOverlap::FProcessor* C : Remaining) { C->UpdateWeight(MaxScores); }
+		Queue.ClearDirty();
 	}
 }
 
@@ -227,15 +269,16 @@ namespace PCGExDiscardByOverlap
 		Overlaps.Add(Overlap);
 	}
 
-	void FProcessor::RemoveOverlap(const TSharedPtr<FOverlap>& InOverlap, TArray<FProcessor*>& Stack)
+	void FProcessor::RemoveOverlap(const TSharedPtr<FOverlap>& InOverlap, FPruningQueue& Queue)
 	{
 		Overlaps.Remove(InOverlap);
+		Queue.Touch(this);
 
 		if (Overlaps.IsEmpty())
 		{
-			// Remove from stack & output.
+			// Remove from queue & output.
 			PCGEX_INIT_IO_VOID(PointDataFacade->Source, PCGExData::EIOInit::Forward)
-			Stack.Remove(this);
+			Queue.Remove(this);
 			return;
 		}
 
@@ -243,15 +286,124 @@ namespace PCGExDiscardByOverlap
 		UpdateWeightValues();
 	}
 
-	void FProcessor::Prune(TArray<FProcessor*>& Stack)
+	void FProcessor::Prune(FPruningQueue& Queue)
 	{
 		for (const TSharedPtr<FOverlap>& Overlap : Overlaps)
 		{
-			Overlap->GetOther(this)->RemoveOverlap(Overlap, Stack);
+			Overlap->GetOther(this)->RemoveOverlap(Overlap, Queue);
 		}
 		Overlaps.Empty();
 	}
 
+	void FPruningQueue::Reserve(const int32 Num)
+	{
+		Heap.Reserve(Num);
+		Dirty.Reserve(Num);
+	}
+
+	void FPruningQueue::Add(FProcessor* InProcessor)
+	{
+		const int32 Index = Heap.Add(InProcessor);
+		InProcessor->QueueIndex = Index;
+		SiftUp(Index);
+	}
+
+	FProcessor* FPruningQueue::Pop()
+	{
+		FProcessor* Best = Heap[0];
+		Touch(Best);
+		Remove(Best);
+		return Best;
+	}
+
+	void FPruningQueue::Remove(FProcessor* InProcessor)
+	{
+		const int32 Index = InProcessor->QueueIndex;
+		if (Index == -1) { return; }
+
+		InProcessor->QueueIndex = -1;
+
+		FProcessor* Last = Heap.Pop(EAllowShrinking::No);
+		if (Last == InProcessor) { return; }
+
+		Place(Index, Last);
+		SiftUp(Index);
+		SiftDown(Last->QueueIndex);
+	}
+
+	void FPruningQueue::Touch(FProcessor* InProcessor)
+	{
+		if (!bMaxScoresDirty && InProcessor->RawScores.AnyScoreEquals(*MaxScores)) { bMaxScoresDirty = true; }
+		if (InProcessor->bQueueDirty) { return; }
+
+		InProcessor->bQueueDirty = true;
+		Dirty.Add(InProcessor);
+	}
+
+	void FPruningQueue::UpdateDirty()
+	{
+		for (FProcessor* P : Dirty)
+		{
+			if (P->QueueIndex == -1) { continue; }
+			SiftUp(P->QueueIndex);
+			SiftDown(P->QueueIndex);
+		}
+	}
+
+	void FPruningQueue::Heapify()
+	{
+		for (int32 i = Heap.Num() / 2 - 1; i >= 0; i--) { SiftDown(i); }
+	}
+
+	void FPruningQueue::ClearDirty()
+	{
+		for (FProcessor* P : Dirty) { P->bQueueDirty = false; }
+		Dirty.Reset();
+		bMaxScoresDirty = false;
+	}
+
+	bool FPruningQueue::IsBetter(const FProcessor* A, const FProcessor* B) const
+	{
+		// Same ordering as the original sort-and-pop : weight first, then lowest IOIndex
+		if (A->Weight == B->Weight) { return A->PointDataFacade->Source->IOIndex < B->PointDataFacade->Source->IOIndex; }
+		return Logic == EPCGExOverlapPruningLogic::HighFirst ? A->Weight > B->Weight : A->Weight < B->Weight;
+	}
+
+	void FPruningQueue::Place(const int32 Index, FProcessor* InProcessor)
+	{
+		Heap[Index] = InProcessor;
+		InProcessor->QueueIndex = Index;
+	}
+
+	void FPruningQueue::SiftUp(int32 Index)
+	{
+		FProcessor* P = Heap[Index];
+		while (Index > 0)
+		{
+			const int32 Parent = (Index - 1) / 2;
+			if (!IsBetter(P, Heap[Parent])) { break; }
+			Place(Index, Heap[Parent]);
+			Index = Parent;
+		}
+		Place(Index, P);
+	}
+
+	void FPruningQueue::SiftDown(int32 Index)
+	{
+		FProcessor* P = Heap[Index];
+		const int32 Num = Heap.Num();
+		while (true)
+		{
+			int32 Child = Index * 2 + 1;
+			if (Child >= Num) { break; }
+			if (Child + 1 < Num && IsBetter(Heap[Child + 1], Heap[Child])) { Child++; }
+			if (!IsBetter(Heap[Child], P)) { break; }
+			Place(Index, Heap[Child]);
+			Index = Child;
+		}
+		Place(Index, P);
+	}
+
 	bool FProcessor::Process(const TSharedPtr<PCGExMT::FTaskManager>& InAsyncManager)
 	{
 		PointDataFacade->bSupportsScopedGet = Context->bScopedAttributeGet;
@@ -157,6 +157,8 @@ namespace PCGExFusePoints
 
 	void FProcessor::CompleteWork()
 	{
+		UnionGraph->Collapse();
+
 		const int32 NumUnionNodes = UnionGraph->Nodes.Num();
 
 		UPCGBasePointData* OutData = PointDataFacade->GetOut();
@@ -219,32 +219,98 @@ namespace PCGExPartitionByValuesBase
 
 		// Prepare each rule so it cache the filter key by index
 		for (PCGExPartition::FRule& Rule : Rules) { Rule.FilteredValues.SetNumZeroed(NumPoints); }
+		LeafIndices.SetNumUninitialized(NumPoints);
 
 		StartParallelLoopForPoints(PCGExData::EIOSide::In);
 
 		return true;
 	}
 
+	void FProcessor::PrepareLoopScopesForPoints(const TArray<PCGExMT::FScope>& Loops)
+	{
+		Histograms.Reset(Loops.Num());
+		for (const PCGExMT::FScope& Loop : Loops) { Histograms.Add(MakeShared<PCGExPartition::FScopeHistogram>(Loop)); }
+	}
+
 	void FProcessor::ProcessPoints(const PCGExMT::FScope& Scope)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(PCGEx::PartitionByValues::ProcessPoints);
 
 		PointDataFacade->Fetch(Scope);
 
+		PCGExPartition::FScopeHistogram& Histogram = *Histograms[Scope.LoopIndex].Get();
+
+		const int32 NumRules = Rules.Num();
+		PCGExPartition::FPartitionKey Key;
+		Key.Keys.SetNumUninitialized(NumRules);
+
 		PCGEX_SCOPE_LOOP(Index)
 		{
-			TSharedPtr<PCGExPartition::FKPartition> Partition = RootPartition;
-			for (PCGExPartition::FRule& Rule : Rules)
+			for (int r = 0; r < NumRules; r++)
 			{
+				PCGExPartition::FRule& Rule = Rules[r];
 				const int64 KeyValue = Rule.Filter(Index);
-				Partition = Partition->GetPartition(KeyValue, &Rule);
 				Rule.FilteredValues[Index] = KeyValue;
+				Key.Keys[r] = KeyValue;
 			}
 
-			Partition->Add(Index);
+			LeafIndices[Index] = Histogram.Add(Key);
 		}
 	}
 
+	void FProcessor::OnPointsProcessingComplete()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGEx::PartitionByValues::MergeHistograms);
+
+		// Resolve leaves in scope order; offsets are running totals so each partition
+		// receives its points in ascending index order once scattered
+		TMap<PCGExPartition::FKPartition*, int32> Totals;
+
+		for (const TSharedPtr<PCGExPartition::FScopeHistogram>& Histogram : Histograms)
+		{
+			const int32 NumLeaves = Histogram->Keys.Num();
+			Histogram->Partitions.SetNumUninitialized(NumLeaves);
+			Histogram->Offsets.SetNumUninitialized(NumLeaves);
+
+			for (int i = 0; i < NumLeaves; i++)
+			{
+				const PCGExPartition::FPartitionKey& Key = Histogram->Keys[i];
+
+				TSharedPtr<PCGExPartition::FKPartition> Partition = RootPartition;
+				for (int r = 0; r < Rules.Num(); r++) { Partition = Partition->GetPartition(Key.Keys[r], &Rules[r]); }
+
+				int32& Total = Totals.FindOrAdd(Partition.Get(), 0);
+				Histogram->Partitions[i] = Partition.Get();
+				Histogram->Offsets[i] = Total;
+				Total += Histogram->Counts[i];
+			}
+
+			Histogram->LeafIndices.Empty();
+			Histogram->Keys.Empty();
+		}
+
+		for (const TPair<PCGExPartition::FKPartition*, int32>& Pair : Totals) { Pair.Key->Points.SetNumUninitialized(Pair.Value); }
+
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, ScatterPoints)
+
+		ScatterPoints->OnIterationCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const int32 Index, const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+
+				PCGExPartition::FScopeHistogram& Histogram = *This->Histograms[Index].Get();
+				const PCGExMT::FScope& PointScope = Histogram.Scope;
+
+				for (int i = PointScope.Start; i < PointScope.End; i++)
+				{
+					const int32 Leaf = This->LeafIndices[i];
+					Histogram.Partitions[Leaf]->Points[Histogram.Offsets[Leaf]++] = i;
+				}
+			};
+
+		ScatterPoints->StartIterations(Histograms.Num(), 1);
+	}
+
 	void FProcessor::ProcessRange(const PCGExMT::FScope& Scope)
 	{
 		PCGEX_SCOPE_LOOP(Index)
@@ -253,6 +319,7 @@ namespace PCGExPartitionByValuesBase
 
 			//Manually create & insert partition at the sorted IO Index
 			const TSharedRef<PCGExData::FPointIO> PartitionIO = Context->MainPoints->Pairs[Partition->IOIndex].ToSharedRef();
+			PartitionIO->MaterializeOutput();
 			PCGEx::SetNumPointsAllocated(PartitionIO->GetOut(), Partition->Points.Num(), PartitionIO->GetAllocations());
 			PartitionIO->InheritProperties(Partition->Points, EPCGPointNativeProperties::All);
 
@@ -96,9 +96,11 @@ namespace PCGExSortPoints
 			return false;
 		}
 
+		if (GetDefault<UPCGExGlobalSettings>()->bPrecomputeSortingKeys) { Sorter->BuildKeys(); }
+
 		TArray<int32> Order;
 		PCGEx::ArrayOfIndices(Order, PointDataFacade->GetNum());
-		Order.Sort([&](const int32 A, const int32 B) { return Sorter->Sort(A, B); });
+		Sorter->Sort(Order);
 
 		PointDataFacade->Source->InheritPoints(Order, 0);
 
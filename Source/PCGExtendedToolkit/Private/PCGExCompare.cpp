@@ -170,6 +170,35 @@ namespace PCGExCompare
 		}
 	}
 
+	void CompareRange(const EPCGExBitflagComparison Method, const TConstArrayView<int64> Flags, const TConstArrayView<int64> Masks, TArrayView<int8> OutResults)
+	{
+		const int32 Num = OutResults.Num();
+		const int64* RESTRICT F = Flags.GetData();
+		const int64* RESTRICT M = Masks.GetData();
+		int8* RESTRICT R = OutResults.GetData();
+
+		switch (Method)
+		{
+		case EPCGExBitflagComparison::MatchPartial:
+			for (int32 i = 0; i < Num; i++) { R[i] = (F[i] & M[i]) != 0; }
+			break;
+		case EPCGExBitflagComparison::MatchFull:
+			for (int32 i = 0; i < Num; i++) { R[i] = (F[i] & M[i]) == M[i]; }
+			break;
+		case EPCGExBitflagComparison::MatchStrict:
+			for (int32 i = 0; i < Num; i++) { R[i] = F[i] == M[i]; }
+			break;
+		case EPCGExBitflagComparison::NoMatchPartial:
+			for (int32 i = 0; i < Num; i++) { R[i] = (F[i] & M[i]) == 0; }
+			break;
+		case EPCGExBitflagComparison::NoMatchFull:
+			for (int32 i = 0; i < Num; i++) { R[i] = (F[i] & M[i]) != M[i]; }
+			break;
+		default: FMemory::Memzero(R, Num);
+			break;
+		}
+	}
+
 	bool HasMatchingTags(const TSharedPtr<PCGExData::FTags>& InTags, const FString& Query, const EPCGExStringMatchMode MatchMode, const bool bStrict)
 	{
 		if (bStrict)
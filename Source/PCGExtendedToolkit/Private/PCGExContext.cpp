@@ -4,6 +4,7 @@
 #include "PCGExContext.h"
 
 #include "PCGComponent.h"
+#include "PCGExGlobalSettings.h"
 #include "PCGExHelpers.h"
 #include "PCGExMacros.h"
 #include "PCGExMT.h"
@@ -136,6 +137,7 @@ TSharedPtr<PCGExMT::FTaskManager> FPCGExContext::GetAsyncManager()
 	if (!AsyncManager)
 	{
 		FWriteScopeLock WriteLock(AsyncLock);
+		if (GetDefault<UPCGExGlobalSettings>()->bTaskGroupTelemetry) { TaskTelemetry = MakeShared<PCGExMT::FTelemetry>(); }
 		AsyncManager = MakeShared<PCGExMT::FTaskManager>(this);
 		PCGExMT::SetWorkPriority(WorkPriority, AsyncManager->WorkPriority);
 	}
@@ -211,6 +213,12 @@ void FPCGExContext::OnComplete()
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExContext::OnComplete);
 
+	if (TaskTelemetry)
+	{
+		TaskTelemetry->Log(GetTaskName());
+		TaskTelemetry.Reset();
+	}
+
 	FWriteScopeLock WriteScopeLock(StagedOutputLock);
 	ManagedObjects->Remove(OutputData.TaggedData);
 }
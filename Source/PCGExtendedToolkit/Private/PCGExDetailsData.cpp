@@ -32,6 +32,9 @@ namespace PCGExDetails
 	template <typename T>
 	T TSettingValueBuffer<T>::Read(const int32 Index) { return Buffer->Read(Index); }
 
+	template <typename T>
+	void TSettingValueBuffer<T>::ReadScope(const PCGExMT::FScope& Scope, TArrayView<T> OutValues) { Buffer->ReadScope(Scope, OutValues); }
+
 	template <typename T>
 	T TSettingValueBuffer<T>::Min() { return Buffer->Min; }
 
@@ -59,6 +62,9 @@ namespace PCGExDetails
 	template <typename T>
 	T TSettingValueSelector<T>::Read(const int32 Index) { return Buffer->Read(Index); }
 
+	template <typename T>
+	void TSettingValueSelector<T>::ReadScope(const PCGExMT::FScope& Scope, TArrayView<T> OutValues) { Buffer->ReadScope(Scope, OutValues); }
+
 	template <typename T>
 	T TSettingValueSelector<T>::Min() { return Buffer->Min; }
 
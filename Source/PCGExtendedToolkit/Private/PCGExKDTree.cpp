@@ -0,0 +1,54 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "PCGExKDTree.h"
+
+#include <algorithm>
+
+namespace PCGExKDTree
+{
+	FPointKDTree::FPointKDTree(TArray<FItem>&& InItems)
+		: Items(MoveTemp(InItems))
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExKDTree::FPointKDTree::Build);
+
+		if (Items.IsEmpty()) { return; }
+
+		// A balanced tree with N / MaxItemsPerLeaf leaves has at most twice as many nodes
+		Nodes.Reserve(2 * FMath::DivideAndRoundUp(Items.Num(), MaxItemsPerLeaf));
+		BuildRecursive(0, Items.Num());
+	}
+
+	int32 FPointKDTree::BuildRecursive(const int32 Start, const int32 End)
+	{
+		const int32 NodeIndex = Nodes.Emplace();
+
+		FBox Bounds = FBox(ForceInit);
+		for (int32 i = Start; i < End; i++) { Bounds += Items[i].Position; }
+
+		Nodes[NodeIndex].Bounds = Bounds;
+		Nodes[NodeIndex].Start = Start;
+		Nodes[NodeIndex].End = End;
+
+		if (End - Start <= MaxItemsPerLeaf) { return NodeIndex; }
+
+		// Split along the largest extent, at the median
+		const FVector Size = Bounds.GetSize();
+		const int32 Axis = Size.X >= Size.Y ? (Size.X >= Size.Z ? 0 : 2) : (Size.Y >= Size.Z ? 1 : 2);
+		const int32 Mid = Start + (End - Start) / 2;
+
+		FItem* Data = Items.GetData();
+		std::nth_element(
+			Data + Start, Data + Mid, Data + End,
+			[Axis](const FItem& A, const FItem& B) { return A.Position[Axis] < B.Position[Axis]; });
+
+		// Recursion may reallocate Nodes if the reserve estimate was short; don't hold references across it
+		const int32 Left = BuildRecursive(Start, Mid);
+		const int32 Right = BuildRecursive(Mid, End);
+
+		Nodes[NodeIndex].Left = Left;
+		Nodes[NodeIndex].Right = Right;
+
+		return NodeIndex;
+	}
+}
@@ -70,6 +70,54 @@ namespace PCGExMT
 		if (GetDefault<UPCGExGlobalSettings>()->bAssertOnEmptyThread) { ensure(false); }
 	}
 
+	void FGroupTelemetry::Append(const FGroupTelemetry& Other)
+	{
+		NumGroups += Other.NumGroups;
+		NumTasks += Other.NumTasks;
+		NumScopes += Other.NumScopes;
+		WallCycles += Other.WallCycles;
+		BusyCycles += Other.BusyCycles;
+		WaitCycles += Other.WaitCycles;
+		MaxTaskCycles = FMath::Max(MaxTaskCycles, Other.MaxTaskCycles);
+	}
+
+	void FTelemetry::Append(const FName InGroupName, const FGroupTelemetry& InTelemetry)
+	{
+		FWriteScopeLock WriteLock(TelemetryLock);
+		Groups.FindOrAdd(InGroupName).Append(InTelemetry);
+	}
+
+	void FTelemetry::Log(const FString& InOwner) const
+	{
+		TArray<TPair<FName, FGroupTelemetry>> Sorted;
+
+		{
+			FReadScopeLock ReadLock(TelemetryLock);
+			Sorted.Reserve(Groups.Num());
+			for (const TPair<FName, FGroupTelemetry>& Pair : Groups) { Sorted.Add(Pair); }
+		}
+
+		if (Sorted.IsEmpty()) { return; }
+
+		Sorted.Sort([](const TPair<FName, FGroupTelemetry>& A, const TPair<FName, FGroupTelemetry>& B) { return A.Value.WallCycles > B.Value.WallCycles; });
+
+		auto ToMs = [](const uint64 Cycles) { return FPlatformTime::ToMilliseconds64(Cycles); };
+
+		for (const TPair<FName, FGroupTelemetry>& Pair : Sorted)
+		{
+			const FGroupTelemetry& G = Pair.Value;
+			const double WallMs = ToMs(G.WallCycles);
+			const double BusyMs = ToMs(G.BusyCycles);
+
+			UE_LOG(
+				LogPCGEx, Log, TEXT("[Telemetry] %s | %s x%d : wall %.3fms, busy %.3fms (x%.2f), wait %.3fms, %d tasks, %d scopes, max task %.3fms (avg %.3fms)"),
+				*InOwner, *Pair.Key.ToString(), G.NumGroups,
+				WallMs, BusyMs, WallMs > 0 ? BusyMs / WallMs : 0,
+				ToMs(G.WaitCycles), G.NumTasks, G.NumScopes,
+				ToMs(G.MaxTaskCycles), G.NumTasks ? BusyMs / G.NumTasks : 0);
+		}
+	}
+
 	FAsyncHandle::~FAsyncHandle()
 	{
 		Cancel(); // Safety first
@@ -155,6 +203,7 @@ namespace PCGExMT
 	void FAsyncMultiHandle::SetRoot(const TSharedPtr<FAsyncMultiHandle>& InRoot, const int32 InHandleIdx)
 	{
 		bForceSync = InRoot->bForceSync;
+		Telemetry = InRoot->Telemetry;
 		FAsyncHandle::SetRoot(InRoot, InHandleIdx);
 	}
 
@@ -181,6 +230,44 @@ namespace PCGExMT
 		return true;
 	}
 
+	void FAsyncMultiHandle::RecordTask(const uint64 InWaitCycles, const uint64 InBusyCycles)
+	{
+		TelemetryTaskCount.fetch_add(1, std::memory_order_relaxed);
+		TelemetryWaitCycles.fetch_add(InWaitCycles, std::memory_order_relaxed);
+		TelemetryBusyCycles.fetch_add(InBusyCycles, std::memory_order_relaxed);
+
+		uint64 CurrentMax = TelemetryMaxTaskCycles.load(std::memory_order_relaxed);
+		while (InBusyCycles > CurrentMax && !TelemetryMaxTaskCycles.compare_exchange_weak(CurrentMax, InBusyCycles, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	void FAsyncMultiHandle::StampLaunch()
+	{
+		if (!Telemetry || FirstLaunchCycles.load(std::memory_order_relaxed)) { return; }
+		uint64 Expected = 0;
+		FirstLaunchCycles.compare_exchange_strong(Expected, FPlatformTime::Cycles64(), std::memory_order_relaxed);
+	}
+
+	void FAsyncMultiHandle::FlushTelemetry()
+	{
+		if (!Telemetry) { return; }
+
+		const uint64 FirstLaunch = FirstLaunchCycles.load(std::memory_order_acquire);
+		if (!FirstLaunch) { return; } // Nothing ran
+
+		FGroupTelemetry GroupTelemetry;
+		GroupTelemetry.NumGroups = 1;
+		GroupTelemetry.NumTasks = TelemetryTaskCount.load(std::memory_order_acquire);
+		GroupTelemetry.NumScopes = TelemetryScopeCount;
+		GroupTelemetry.WallCycles = FPlatformTime::Cycles64() - FirstLaunch;
+		GroupTelemetry.BusyCycles = TelemetryBusyCycles.load(std::memory_order_acquire);
+		GroupTelemetry.WaitCycles = TelemetryWaitCycles.load(std::memory_order_acquire);
+		GroupTelemetry.MaxTaskCycles = TelemetryMaxTaskCycles.load(std::memory_order_acquire);
+
+		Telemetry->Append(GroupName, GroupTelemetry);
+	}
+
 	void FAsyncMultiHandle::HandleTaskStart()
 	{
 	}
@@ -193,6 +280,7 @@ namespace PCGExMT
 		{
 			// Register to self first
 			InTask->SetParent(SharedThis(this));
+			StampLaunch();
 
 			// Then push to root
 			PinnedRoot->StartBackgroundTask(InTask);
@@ -207,6 +295,7 @@ namespace PCGExMT
 		{
 			// Register to self first
 			InTask->SetParent(SharedThis(this));
+			StampLaunch();
 
 			// Then push to root
 			PinnedRoot->StartSynchronousTask(InTask);
@@ -215,6 +304,8 @@ namespace PCGExMT
 
 	void FAsyncMultiHandle::End(const bool bIsCancellation)
 	{
+		if (!bIsCancellation) { FlushTelemetry(); }
+
 		// Complete callback before notifying hierarchy
 		if (!bIsCancellation && OnCompleteCallback)
 		{
@@ -230,6 +321,14 @@ namespace PCGExMT
 		bIsCancelled.store(false, std::memory_order_release);
 		PendingTaskCount.store(0, std::memory_order_release);
 		CompletedTaskCount.store(0, std::memory_order_release);
+
+		FirstLaunchCycles.store(0, std::memory_order_release);
+		TelemetryTaskCount.store(0, std::memory_order_release);
+		TelemetryBusyCycles.store(0, std::memory_order_release);
+		TelemetryWaitCycles.store(0, std::memory_order_release);
+		TelemetryMaxTaskCycles.store(0, std::memory_order_release);
+		TelemetryScopeCount = 0;
+
 		SetState(EAsyncHandleState::Idle);
 	}
 
@@ -262,6 +361,7 @@ namespace PCGExMT
 	{
 		PCGEX_LOG_CTR(FTaskManager)
 		WorkPermit = Context->GetWorkPermit();
+		Telemetry = Context->TaskTelemetry;
 	}
 
 	FTaskManager::~FTaskManager()
@@ -442,19 +542,40 @@ namespace PCGExMT
 		TSharedPtr<FTaskManager> LocalManager = SharedThis(this);
 		InTask->SetRoot(LocalManager, Idx);
 
+		// Tasks launched straight from the manager have no parent group, account for them on the manager itself
+		uint64 QueuedCycles = 0;
+		if (Telemetry)
+		{
+			if (!InTask->ParentHandle.IsValid()) { StampLaunch(); }
+			QueuedCycles = FPlatformTime::Cycles64();
+		}
+
 		PCGEX_SHARED_THIS_DECL
 		UE::Tasks::Launch(
 				*InTask->HandleId(),
 				[
 					WeakManager = TWeakPtr<FTaskManager>(LocalManager),
-					Task = InTask]()
+					Task = InTask, QueuedCycles]()
 				{
 					const TSharedPtr<FTaskManager> Manager = WeakManager.Pin();
 					if (!Manager || !Manager->IsAvailable()) { return; }
 
 					if (Task->Start())
 					{
-						Task->ExecuteTask(Manager);
+						if (QueuedCycles)
+						{
+							const uint64 StartCycles = FPlatformTime::Cycles64();
+							Task->ExecuteTask(Manager);
+
+							// Record before completion, completing the last task ends and flushes the group
+							const TSharedPtr<FAsyncMultiHandle> Owner = Task->ParentHandle.Pin();
+							(Owner ? Owner.Get() : Manager.Get())->RecordTask(StartCycles - QueuedCycles, FPlatformTime::Cycles64() - StartCycles);
+						}
+						else
+						{
+							Task->ExecuteTask(Manager);
+						}
+
 						Task->Complete();
 					}
 
@@ -491,6 +612,7 @@ namespace PCGExMT
 			bDaisyChained = true;
 
 			SetExpectedTaskCount(SubLoopScopes(Loops, MaxItems, SanitizedChunkSize));
+			TelemetryScopeCount += Loops.Num();
 
 			if (OnPrepareSubLoopsCallback) { OnPrepareSubLoopsCallback(Loops); }
 
@@ -521,6 +643,7 @@ namespace PCGExMT
 		// Compute sub scopes
 		SetExpectedTaskCount(SubLoopScopes(Loops, MaxItems, FMath::Max(1, ChunkSize)));
 		StaticCastSharedPtr<FTaskManager>(PinnedRoot)->ReserveTasks(Loops.Num());
+		TelemetryScopeCount += Loops.Num();
 
 		bDaisyChained = true;
 
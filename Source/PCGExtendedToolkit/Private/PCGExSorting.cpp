@@ -9,6 +9,8 @@
 #include "Data/PCGExDataTag.h"
 #include "Data/PCGExPointIO.h"
 #include "Data/PCGExProxyData.h"
+#include "Async/ParallelFor.h"
+#include "Algo/StableSort.h"
 
 #define LOCTEXT_NAMESPACE "PCGExModularSortPoints"
 #define PCGEX_NAMESPACE ModularSortPoints
@@ -62,14 +64,21 @@ void FPCGExCollectionSortingDetails::Sort(const FPCGContext* InContext, const TS
 		}
 	}
 
-	if (Direction == EPCGExSortDirection::Ascending)
-	{
-		Pairs.Sort([&](const TSharedPtr<PCGExData::FPointIO>& A, const TSharedPtr<PCGExData::FPointIO>& B) { return Scores[A->IOIndex] < Scores[B->IOIndex]; });
-	}
-	else
-	{
-		Pairs.Sort([&](const TSharedPtr<PCGExData::FPointIO>& A, const TSharedPtr<PCGExData::FPointIO>& B) { return Scores[A->IOIndex] > Scores[B->IOIndex]; });
-	}
+	// Scores are already a key column; fold direction in and radix sort them
+	const double Sign = Direction == EPCGExSortDirection::Ascending ? 1 : -1;
+
+	TArray<uint64> Keys;
+	Keys.SetNumUninitialized(Pairs.Num());
+	for (int i = 0; i < Pairs.Num(); i++) { Keys[i] = PCGExSorting::ToRadixKey(Scores[i] * Sign); }
+
+	TArray<int32> Order;
+	PCGEx::ArrayOfIndices(Order, Pairs.Num());
+	PCGExSorting::RadixSort(Order, Keys);
+
+	TArray<TSharedPtr<PCGExData::FPointIO>> SortedPairs;
+	SortedPairs.Reserve(Pairs.Num());
+	for (const int32 i : Order) { SortedPairs.Add(Pairs[i]); }
+	Pairs = MoveTemp(SortedPairs);
 
 	for (int i = 0; i < Pairs.Num(); i++) { Pairs[i]->IOIndex = i; }
 }
@@ -109,6 +118,163 @@ namespace PCGExSorting
 		Pin.PinStatus = InStatus;
 	}
 
+	namespace
+	{
+		int32 GetNumSortChunks(const int32 Num)
+		{
+			constexpr int32 MinChunkSize = 4096;
+			return FMath::Clamp(Num / MinChunkSize, 1, FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+		}
+	}
+
+	void RadixSort(TArray<int32>& InOutOrder, const TArray<uint64>& Keys)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExSorting::RadixSort);
+
+		const int32 Num = InOutOrder.Num();
+
+		if (GetDefault<UPCGExGlobalSettings>()->IsSmallPointSize(Num))
+		{
+			Algo::StableSort(InOutOrder, [&](const int32 A, const int32 B) { return Keys[A] < Keys[B]; });
+			return;
+		}
+
+		struct FKeyedIndex
+		{
+			uint64 Key;
+			int32 Index;
+		};
+
+		TArray<FKeyedIndex> Items;
+		TArray<FKeyedIndex> Scratch;
+		PCGEx::InitArray(Items, Num);
+		PCGEx::InitArray(Scratch, Num);
+
+		for (int32 i = 0; i < Num; i++) { Items[i] = FKeyedIndex{Keys[InOutOrder[i]], InOutOrder[i]}; }
+
+		constexpr int32 NumBuckets = 256;
+		const int32 NumChunks = GetNumSortChunks(Num);
+		const int32 ChunkSize = FMath::DivideAndRoundUp(Num, NumChunks);
+
+		// Histograms laid out per chunk
+		TArray<int32> Histograms;
+		Histograms.SetNumUninitialized(NumChunks * NumBuckets);
+
+		for (int32 Pass = 0; Pass < 8; Pass++)
+		{
+			const int32 Shift = Pass * 8;
+
+			FMemory::Memzero(Histograms.GetData(), Histograms.Num() * sizeof(int32));
+
+			ParallelFor(
+				NumChunks, [&](const int32 Chunk)
+				{
+					int32* Histogram = Histograms.GetData() + Chunk * NumBuckets;
+					const int32 End = FMath::Min(Num, (Chunk + 1) * ChunkSize);
+					for (int32 i = Chunk * ChunkSize; i < End; i++) { Histogram[(Items[i].Key >> Shift) & 0xFF]++; }
+				});
+
+			// Skip passes where every key shares the same digit
+			bool bTrivialPass = false;
+			for (int32 Bucket = 0; Bucket < NumBuckets; Bucket++)
+			{
+				int32 Total = 0;
+				for (int32 Chunk = 0; Chunk < NumChunks; Chunk++) { Total += Histograms[Chunk * NumBuckets + Bucket]; }
+				if (Total == 0) { continue; }
+				bTrivialPass = Total == Num;
+				break;
+			}
+
+			if (bTrivialPass) { continue; }
+
+			// Exclusive prefix sum in (bucket, chunk) order keeps the sort stable
+			int32 Offset = 0;
+			for (int32 Bucket = 0; Bucket < NumBuckets; Bucket++)
+			{
+				for (int32 Chunk = 0; Chunk < NumChunks; Chunk++)
+				{
+					int32& Count = Histograms[Chunk * NumBuckets + Bucket];
+					const int32 C = Count;
+					Count = Offset;
+					Offset += C;
+				}
+			}
+
+			ParallelFor(
+				NumChunks, [&](const int32 Chunk)
+				{
+					int32* Offsets = Histograms.GetData() + Chunk * NumBuckets;
+					const int32 End = FMath::Min(Num, (Chunk + 1) * ChunkSize);
+					for (int32 i = Chunk * ChunkSize; i < End; i++) { Scratch[Offsets[(Items[i].Key >> Shift) & 0xFF]++] = Items[i]; }
+				});
+
+			Swap(Items, Scratch);
+		}
+
+		for (int32 i = 0; i < Num; i++) { InOutOrder[i] = Items[i].Index; }
+	}
+
+	void ParallelMergeSort(TArray<int32>& InOutOrder, TFunctionRef<bool(const int32, const int32)> Predicate)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExSorting::ParallelMergeSort);
+
+		const int32 Num = InOutOrder.Num();
+		const int32 NumChunks = GetNumSortChunks(Num);
+
+		if (NumChunks <= 1)
+		{
+			Algo::StableSort(InOutOrder, Predicate);
+			return;
+		}
+
+		const int32 ChunkSize = FMath::DivideAndRoundUp(Num, NumChunks);
+
+		ParallelFor(
+			NumChunks, [&](const int32 Chunk)
+			{
+				const int32 Start = Chunk * ChunkSize;
+				const int32 End = FMath::Min(Num, Start + ChunkSize);
+				if (Start >= End) { return; }
+				Algo::StableSort(TArrayView<int32>(InOutOrder.GetData() + Start, End - Start), Predicate);
+			});
+
+		TArray<int32> Buffer;
+		PCGEx::InitArray(Buffer, Num);
+
+		TArray<int32>* Src = &InOutOrder;
+		TArray<int32>* Dst = &Buffer;
+
+		// Merge sorted runs pairwise until a single run is left
+		for (int32 RunSize = ChunkSize; RunSize < Num; RunSize *= 2)
+		{
+			const int32 NumMerges = FMath::DivideAndRoundUp(Num, RunSize * 2);
+
+			ParallelFor(
+				NumMerges, [&](const int32 MergeIndex)
+				{
+					const int32* Data = Src->GetData();
+					int32* Out = Dst->GetData();
+
+					const int32 Start = MergeIndex * RunSize * 2;
+					const int32 Mid = FMath::Min(Num, Start + RunSize);
+					const int32 End = FMath::Min(Num, Start + RunSize * 2);
+
+					int32 L = Start;
+					int32 R = Mid;
+					int32 W = Start;
+
+					// Right only wins on strict ordering, which keeps the merge stable
+					while (L < Mid && R < End) { Out[W++] = Predicate(Data[R], Data[L]) ? Data[R++] : Data[L++]; }
+					while (L < Mid) { Out[W++] = Data[L++]; }
+					while (R < End) { Out[W++] = Data[R++]; }
+				});
+
+			Swap(Src, Dst);
+		}
+
+		if (Src != &InOutOrder) { InOutOrder = MoveTemp(*Src); }
+	}
+
 	FPointSorter::FPointSorter(FPCGExContext* InContext, const TSharedRef<PCGExData::FFacade>& InDataFacade, TArray<FPCGExSortRuleConfig> InRuleConfigs)
 		: ExecutionContext(InContext), DataFacade(InDataFacade)
 	{
@@ -230,8 +396,93 @@ namespace PCGExSorting
 		return !RuleHandlers.IsEmpty();
 	}
 
+	bool FPointSorter::BuildKeys()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExSorting::FPointSorter::BuildKeys);
+
+		if (RuleHandlers.IsEmpty() || !DataFacade) { return false; }
+
+		const int32 NumPoints = DataFacade->GetNum();
+		const double Direction = SortDirection == EPCGExSortDirection::Descending ? -1 : 1;
+
+		for (const TSharedPtr<FRuleHandler>& RuleHandler : RuleHandlers)
+		{
+			if (!RuleHandler->Buffer) { return false; }
+
+			const double Sign = RuleHandler->bInvertRule ? -Direction : Direction;
+			PCGEx::InitArray(RuleHandler->Keys, NumPoints);
+
+			ParallelFor(
+				NumPoints, [&](const int32 i) { RuleHandler->Keys[i] = RuleHandler->MakeKey(RuleHandler->Buffer->ReadAsDouble(i), Sign); },
+				GetDefault<UPCGExGlobalSettings>()->IsSmallPointSize(NumPoints) ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+		}
+
+		bHasKeys = true;
+		return true;
+	}
+
+	bool FPointSorter::BuildKeys(const TArray<TSharedRef<PCGExData::FFacade>>& InDataFacades)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExSorting::FPointSorter::BuildKeys);
+
+		if (RuleHandlers.IsEmpty()) { return false; }
+
+		const double Direction = SortDirection == EPCGExSortDirection::Descending ? -1 : 1;
+
+		for (const TSharedPtr<FRuleHandler>& RuleHandler : RuleHandlers)
+		{
+			const double Sign = RuleHandler->bInvertRule ? -Direction : Direction;
+			RuleHandler->DataKeys.SetNum(RuleHandler->Buffers.Num());
+
+			for (const TSharedRef<PCGExData::FFacade>& Facade : InDataFacades)
+			{
+				const TSharedPtr<PCGExData::IBufferProxy>& Buffer = RuleHandler->Buffers[Facade->Idx];
+				if (!Buffer) { return false; }
+
+				TArray<double>& Keys = RuleHandler->DataKeys[Facade->Idx];
+				const int32 NumPoints = Facade->GetNum();
+				PCGEx::InitArray(Keys, NumPoints);
+
+				ParallelFor(
+					NumPoints, [&](const int32 i) { Keys[i] = RuleHandler->MakeKey(Buffer->ReadAsDouble(i), Sign); },
+					GetDefault<UPCGExGlobalSettings>()->IsSmallPointSize(NumPoints) ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+			}
+		}
+
+		bHasDataKeys = true;
+		return true;
+	}
+
+	void FPointSorter::Sort(TArray<int32>& InOutOrder)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExSorting::FPointSorter::SortOrder);
+
+		if (!bHasKeys)
+		{
+			InOutOrder.Sort([&](const int32 A, const int32 B) { return Sort(A, B); });
+			return;
+		}
+
+		if (RuleHandlers.Num() == 1)
+		{
+			const TArray<double>& Keys = RuleHandlers[0]->Keys;
+
+			TArray<uint64> RadixKeys;
+			PCGEx::InitArray(RadixKeys, Keys.Num());
+			for (int32 i = 0; i < Keys.Num(); i++) { RadixKeys[i] = ToRadixKey(Keys[i]); }
+
+			RadixSort(InOutOrder, RadixKeys);
+		}
+		else
+		{
+			ParallelMergeSort(InOutOrder, [&](const int32 A, const int32 B) { return SortKeys(A, B); });
+		}
+	}
+
 	bool FPointSorter::Sort(const int32 A, const int32 B)
 	{
+		if (bHasKeys) { return SortKeys(A, B); }
+
 		int Result = 0;
 		for (const TSharedPtr<FRuleHandler>& RuleHandler : RuleHandlers)
 		{
@@ -251,6 +502,8 @@ namespace PCGExSorting
 
 	bool FPointSorter::Sort(const PCGExData::FElement A, const PCGExData::FElement B)
 	{
+		if (bHasDataKeys) { return SortKeys(A, B); }
+
 		int Result = 0;
 		for (const TSharedPtr<FRuleHandler>& RuleHandler : RuleHandlers)
 		{
@@ -23,7 +23,7 @@ TArray<FPCGPinProperties> UPCGExPathCrossingsSettings::InputPinProperties() cons
 }
 
 PCGEX_INITIALIZE_ELEMENT(PathCrossings)
-PCGEX_ELEMENT_BATCH_POINT_IMPL(PathCrossings)
+PCGEX_ELEMENT_BATCH_POINT_IMPL_ADV(PathCrossings)
 
 bool FPCGExPathCrossingsElement::Boot(FPCGExContext* InContext) const
 {
@@ -167,15 +167,20 @@ namespace PCGExPathCrossings
 		CanCutFilterManager.Reset();
 		CanBeCutFilterManager.Reset();
 
-		if (bCanCut) { Path->BuildPartialEdgeOctree(CanCut); }
-
-		CanCut.Empty();
+		if (bSelfIntersectionOnly)
+		{
+			// Cross-path queries go through the batch-wide BVH, only self-intersection needs a per-path octree
+			if (bCanCut) { Path->BuildPartialEdgeOctree(CanCut); }
+			CanCut.Empty();
+		}
 
 		return true;
 	}
 
 	void FProcessor::CompleteWork()
 	{
+		CanCut.Empty(); // Consumed by the batch when building the cutter BVH
+
 		if (!bCanBeCut) { return; }
 		if (bSelfIntersectionOnly && !bCanCut) { return; }
 
@@ -184,35 +189,21 @@ namespace PCGExPathCrossings
 
 	void FProcessor::ProcessRange(const PCGExMT::FScope& Scope)
 	{
-		const TSharedPtr<PCGExPointsMT::IBatch> Parent = ParentBatch.Pin();
+		const TSharedPtr<FBatch> Parent = StaticCastSharedPtr<FBatch>(ParentBatch.Pin());
 		if (!Parent) { return; }
 
-		const TSharedPtr<PCGExPointsMT::TBatch<FProcessor>> TypedParent = StaticCastSharedPtr<PCGExPointsMT::TBatch<FProcessor>>(Parent);
-
-		TArray<TSharedPtr<PCGExPaths::FPath>> Cutters;
+		const PCGExPaths::FPathEdgeBVH* CutterBVH = nullptr;
 
 		if (bSelfIntersectionOnly)
 		{
-			if (bCanCut && Path->GetEdgeOctree()) { Cutters.Add(Path); }
+			if (!bCanCut || !Path->GetEdgeOctree()) { return; }
 		}
 		else
 		{
-			Cutters.Reserve(Parent->ProcessorFacades.Num());
-
-
-			for (int Pi = 0; Pi < TypedParent->GetNumProcessors(); Pi++)
-			{
-				const TSharedPtr<FProcessor> P = TypedParent->GetProcessor<FProcessor>(Pi);
-
-				if (!Details.bEnableSelfIntersection && P.Get() == this) { continue; }
-				if (!P->bCanCut || !P->Path->GetEdgeOctree()) { continue; }
-
-				Cutters.Add(P->Path);
-			}
+			CutterBVH = &Parent->GetCutterBVH();
+			if (CutterBVH->IsEmpty()) { return; }
 		}
 
-		if (Cutters.IsEmpty()) { return; }
-
 		PCGEX_SCOPE_LOOP(Index)
 		{
 			EdgeCrossings[Index] = nullptr;
@@ -224,13 +215,24 @@ namespace PCGExPathCrossings
 
 			const TSharedPtr<PCGExPaths::FPathEdgeCrossings> NewCrossing = MakeShared<PCGExPaths::FPathEdgeCrossings>(Index);
 
-			for (const TSharedPtr<PCGExPaths::FPath>& OtherPath : Cutters)
+			if (CutterBVH)
 			{
-				OtherPath->GetEdgeOctree()->FindElementsWithBoundsTest(
+				CutterBVH->FindOverlaps(
+					Edge.Bounds.GetBox(),
+					[&](const PCGExPaths::FPathEdgeBVH::FItem& Item)
+					{
+						const TSharedPtr<PCGExPaths::FPath>& OtherPath = Parent->GetCutterPath(Item.Path);
+						if (!Details.bEnableSelfIntersection && OtherPath == Path) { return; }
+						NewCrossing->FindSplit(Path, Edge, PathLength, OtherPath, OtherPath->Edges[Item.Edge], Details);
+					});
+			}
+			else
+			{
+				Path->GetEdgeOctree()->FindElementsWithBoundsTest(
 					Edge.Bounds.GetBox(),
 					[&](const PCGExPaths::FPathEdge* OtherEdge)
 					{
-						NewCrossing->FindSplit(Path, Edge, PathLength, OtherPath, *OtherEdge, Details);
+						NewCrossing->FindSplit(Path, Edge, PathLength, Path, *OtherEdge, Details);
 					});
 			}
 
@@ -495,6 +497,66 @@ namespace PCGExPathCrossings
 
 		CrossBlendTask->StartSubLoops(Path->NumEdges, GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
 	}
+
+	void FBatch::CompleteWork()
+	{
+		PCGEX_TYPED_CONTEXT_AND_SETTINGS(PathCrossings)
+
+		if (Settings->bSelfIntersectionOnly)
+		{
+			TBatch<FProcessor>::CompleteWork();
+			return;
+		}
+
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, BuildCutterBVHTask)
+
+		BuildCutterBVHTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->OnCutterBVHBuilt();
+			};
+
+		BuildCutterBVHTask->AddSimpleCallback(
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->BuildCutterBVH();
+			});
+
+		BuildCutterBVHTask->StartSimpleCallbacks();
+	}
+
+	void FBatch::BuildCutterBVH()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExPathCrossings::BuildCutterBVH);
+
+		const int32 NumProcessors = GetNumProcessors();
+		CutterPaths.Init(nullptr, NumProcessors);
+
+		// Resolved once per path, the filter below runs once per edge
+		TArray<const TBitArray<>*> CanCut;
+		CanCut.Init(nullptr, NumProcessors);
+
+		for (int i = 0; i < NumProcessors; i++)
+		{
+			const TSharedPtr<FProcessor> P = GetProcessor<FProcessor>(i);
+			if (!P->bIsProcessorValid || !P->bCanCut || !P->Path) { continue; }
+			CutterPaths[i] = P->Path;
+			CanCut[i] = &P->CanCut;
+		}
+
+		CutterBVH.Build(
+			CutterPaths, [&](const int32 PathIndex, const int32 EdgeIndex)
+			{
+				return static_cast<bool>((*CanCut[PathIndex])[EdgeIndex]);
+			});
+	}
+
+	void FBatch::OnCutterBVHBuilt()
+	{
+		TBatch<FProcessor>::CompleteWork();
+	}
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -72,7 +72,11 @@ namespace PCGExPathSolidify
 		PathLength = Path->AddExtra<PCGExPaths::FPathEdgeLength>();
 		Path->IOIndex = PointDataFacade->Source->IOIndex;
 
-		if (!bClosedLoop && Settings->bRemoveLastPoint) { PointDataFacade->GetOut()->SetNumPoints(Path->LastIndex); }
+		if (!bClosedLoop && Settings->bRemoveLastPoint)
+		{
+			PointIO->MaterializeOutput();
+			PointDataFacade->GetOut()->SetNumPoints(Path->LastIndex);
+		}
 
 		PointDataFacade->GetOut()->AllocateProperties(
 			EPCGPointNativeProperties::Transform |
@@ -3,6 +3,8 @@
 
 #include "Paths/PCGExPaths.h"
 
+#include <algorithm>
+
 #include "Data/PCGSplineData.h"
 #include "GeomTools.h"
 #include "Collections/PCGExMeshCollection.h"
@@ -788,6 +790,287 @@ namespace PCGExPaths
 		return Intersection;
 	}
 
+	FPolygonSlabs::FPolygonSlabs(const TArray<FVector2D>& InPoints)
+	{
+		const int32 NumPoints = InPoints.Num();
+		if (NumPoints < 3) { return; }
+
+		double MaxY = InPoints[0].Y;
+		MinY = MaxY;
+		for (const FVector2D& P : InPoints)
+		{
+			MinY = FMath::Min(MinY, P.Y);
+			MaxY = FMath::Max(MaxY, P.Y);
+		}
+
+		const double Height = MaxY - MinY;
+		if (Height <= 0) { return; }
+
+		// Roughly four edges per slab for well-behaved polygons
+		NumSlabs = FMath::Clamp(NumPoints / 4, 1, MaxSlabs);
+		InvSlabHeight = NumSlabs / Height;
+
+		// Two passes : count edges per slab, then scatter
+		SlabStarts.SetNumZeroed(NumSlabs + 1);
+
+		for (int32 i = 0; i < NumPoints; i++)
+		{
+			const double AY = InPoints[i].Y;
+			const double BY = InPoints[(i + 1) % NumPoints].Y;
+			const int32 From = GetSlab(FMath::Min(AY, BY));
+			const int32 To = GetSlab(FMath::Max(AY, BY));
+			for (int32 s = From; s <= To; s++) { SlabStarts[s + 1]++; }
+		}
+
+		for (int32 s = 0; s < NumSlabs; s++) { SlabStarts[s + 1] += SlabStarts[s]; }
+
+		SlabEdges.SetNumUninitialized(SlabStarts[NumSlabs]);
+		TArray<int32> Cursors(SlabStarts.GetData(), NumSlabs);
+
+		for (int32 i = 0; i < NumPoints; i++)
+		{
+			const double AY = InPoints[i].Y;
+			const double BY = InPoints[(i + 1) % NumPoints].Y;
+			const int32 From = GetSlab(FMath::Min(AY, BY));
+			const int32 To = GetSlab(FMath::Max(AY, BY));
+			for (int32 s = From; s <= To; s++) { SlabEdges[Cursors[s]++] = i; }
+		}
+	}
+
+	bool FPolygonSlabs::IsInside(const FVector2D& InPoint, const TArray<FVector2D>& InPoints) const
+	{
+		const int32 NumPoints = InPoints.Num();
+		const int32 Slab = GetSlab(InPoint.Y);
+
+		int32 Winding = 0;
+
+		for (int32 i = SlabStarts[Slab]; i < SlabStarts[Slab + 1]; i++)
+		{
+			const int32 E = SlabEdges[i];
+			const FVector2D& A = InPoints[E];
+			const FVector2D& B = InPoints[(E + 1) % NumPoints];
+
+			const double Side = FVector2D::CrossProduct(B - A, InPoint - A);
+
+			if (A.Y <= InPoint.Y)
+			{
+				// Upward crossing, point strictly left of the edge
+				if (B.Y > InPoint.Y && Side > 0) { Winding++; }
+			}
+			else if (B.Y <= InPoint.Y && Side < 0)
+			{
+				// Downward crossing, point strictly right of the edge
+				Winding--;
+			}
+		}
+
+		return Winding != 0;
+	}
+
+	FSplineSegmentTree::FSplineSegmentTree(const FPCGSplineStruct& InSpline)
+		: Spline(&InSpline)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExPaths::FSplineSegmentTree::Build);
+
+		const FInterpCurveVector& Curve = InSpline.GetSplinePointsPosition();
+		const int32 NumPoints = Curve.Points.Num();
+		if (NumPoints < 2) { return; }
+
+		const int32 NumSegments = Curve.bIsLooped ? NumPoints : NumPoints - 1;
+		Spans.Reserve(NumSegments * SpansPerCurveSegment);
+
+		for (int32 i = 0; i < NumSegments; i++)
+		{
+			// Same indexing as FInterpCurve::FindNearestOnSegment, including the closing segment of looped curves
+			const bool bClosing = Curve.bIsLooped && i == NumPoints - 1;
+			const FInterpCurvePoint<FVector>& Prev = Curve.Points[i];
+			const FInterpCurvePoint<FVector>& Next = Curve.Points[bClosing ? 0 : i + 1];
+
+			if (!Prev.IsCurveKey())
+			{
+				// Linear & constant segments never leave their end points' box
+				FSpan& Span = Spans.Emplace_GetRef();
+				Span.Bounds += Prev.OutVal;
+				Span.Bounds += Next.OutVal;
+				Span.Segment = i;
+				continue;
+			}
+
+			const double Diff = bClosing ? Curve.LoopKeyOffset : Next.InVal - Prev.InVal;
+			const FVector& P0 = Prev.OutVal;
+			const FVector& P1 = Next.OutVal;
+			const FVector T0 = Prev.LeaveTangent * Diff;
+			const FVector T1 = Next.ArriveTangent * Diff;
+
+			// Every span is a cubic of its own; the hull of its Bezier control points contains it
+			constexpr double Third = 1.0 / (3.0 * SpansPerCurveSegment);
+
+			FVector A = P0;
+			FVector DA = T0;
+
+			for (int32 j = 1; j <= SpansPerCurveSegment; j++)
+			{
+				const bool bLast = j == SpansPerCurveSegment;
+				const double Alpha = static_cast<double>(j) / SpansPerCurveSegment;
+				const FVector B = bLast ? P1 : FMath::CubicInterp(P0, T0, P1, T1, Alpha);
+				const FVector DB = bLast ? T1 : FMath::CubicInterpDerivative(P0, T0, P1, T1, Alpha);
+
+				FSpan& Span = Spans.Emplace_GetRef();
+				Span.Bounds += A;
+				Span.Bounds += A + DA * Third;
+				Span.Bounds += B - DB * Third;
+				Span.Bounds += B;
+				Span.Segment = i;
+
+				A = B;
+				DA = DB;
+			}
+		}
+
+		Nodes.Reserve(2 * FMath::DivideAndRoundUp(Spans.Num(), MaxSpansPerLeaf));
+		BuildRecursive(0, Spans.Num());
+	}
+
+	int32 FSplineSegmentTree::BuildRecursive(const int32 Start, const int32 End)
+	{
+		const int32 NodeIndex = Nodes.Emplace();
+
+		FBox Bounds = FBox(ForceInit);
+		for (int32 i = Start; i < End; i++) { Bounds += Spans[i].Bounds; }
+
+		Nodes[NodeIndex].Bounds = Bounds;
+		Nodes[NodeIndex].Start = Start;
+		Nodes[NodeIndex].End = End;
+
+		if (End - Start <= MaxSpansPerLeaf) { return NodeIndex; }
+
+		// Split along the largest extent, at the median span center
+		const FVector Size = Bounds.GetSize();
+		const int32 Axis = Size.X >= Size.Y ? (Size.X >= Size.Z ? 0 : 2) : (Size.Y >= Size.Z ? 1 : 2);
+		const int32 Mid = Start + (End - Start) / 2;
+
+		FSpan* Data = Spans.GetData();
+		std::nth_element(
+			Data + Start, Data + Mid, Data + End,
+			[Axis](const FSpan& A, const FSpan& B) { return A.Bounds.GetCenter()[Axis] < B.Bounds.GetCenter()[Axis]; });
+
+		const int32 Left = BuildRecursive(Start, Mid);
+		const int32 Right = BuildRecursive(Mid, End);
+
+		Nodes[NodeIndex].Left = Left;
+		Nodes[NodeIndex].Right = Right;
+
+		return NodeIndex;
+	}
+
+	FBox FSplineSegmentTree::GetWorldBounds() const
+	{
+		if (!IsValid())
+		{
+			// Single point spline, or nothing at all
+			if (!Spline || Spline->GetSplinePointsPosition().Points.IsEmpty()) { return FBox(ForceInit); }
+			const FVector Location = Spline->GetTransform().TransformPosition(Spline->GetSplinePointsPosition().Points[0].OutVal);
+			return FBox(Location, Location);
+		}
+
+		return Nodes[0].Bounds.TransformBy(Spline->GetTransform());
+	}
+
+	bool FSplineSegmentTree::FindInputKeyClosestToWorldLocation(const FVector& WorldLocation, float& OutKey, const double MaxDistance) const
+	{
+		OutKey = 0;
+
+		if (!Spline) { return false; }
+		if (!IsValid())
+		{
+			OutKey = Spline->FindInputKeyClosestToWorldLocation(WorldLocation);
+			return true;
+		}
+
+		const FTransform& Transform = Spline->GetTransform();
+		const FVector LocalLocation = Transform.InverseTransformPosition(WorldLocation);
+
+		double BestDistSquared = MAX_dbl;
+		if (MaxDistance < MAX_dbl)
+		{
+			// World distances are at least local distances times the smallest scale axis
+			const double MinScale = Transform.GetScale3D().GetAbs().GetMin();
+			if (MinScale > UE_SMALL_NUMBER) { BestDistSquared = FMath::Square(MaxDistance / MinScale); }
+		}
+
+		const FInterpCurveVector& Curve = Spline->GetSplinePointsPosition();
+
+		int32 BestSegment = -1;
+		float BestKey = 0;
+
+		// Spans of a segment share the same refinement; only run it once
+		TArray<int32, TInlineAllocator<16>> Refined;
+
+		int32 Stack[64];
+		int32 StackSize = 0;
+		Stack[StackSize++] = 0;
+
+		while (StackSize)
+		{
+			const FNode& Node = Nodes[Stack[--StackSize]];
+
+			// Strict comparison keeps equidistant subtrees alive for deterministic tie-breaking
+			if (Node.Bounds.ComputeSquaredDistanceToPoint(LocalLocation) > BestDistSquared) { continue; }
+
+			if (Node.IsLeaf())
+			{
+				for (int32 i = Node.Start; i < Node.End; i++)
+				{
+					const FSpan& Span = Spans[i];
+					if (Span.Bounds.ComputeSquaredDistanceToPoint(LocalLocation) > BestDistSquared) { continue; }
+					if (Refined.Contains(Span.Segment)) { continue; }
+
+					Refined.Add(Span.Segment);
+
+					float DistSquared = 0;
+					const float Key = Curve.FindNearestOnSegment(LocalLocation, Span.Segment, DistSquared);
+
+					// Ties go to the lowest segment, like the linear scan in FInterpCurve::FindNearest
+					if (DistSquared > BestDistSquared) { continue; }
+					if (DistSquared == BestDistSquared && BestSegment != -1 && Span.Segment > BestSegment) { continue; }
+
+					BestDistSquared = DistSquared;
+					BestSegment = Span.Segment;
+					BestKey = Key;
+				}
+
+				continue;
+			}
+
+			// Visit closest child first
+			const double DL = Nodes[Node.Left].Bounds.ComputeSquaredDistanceToPoint(LocalLocation);
+			const double DR = Nodes[Node.Right].Bounds.ComputeSquaredDistanceToPoint(LocalLocation);
+
+			if (DL <= DR)
+			{
+				Stack[StackSize++] = Node.Right;
+				Stack[StackSize++] = Node.Left;
+			}
+			else
+			{
+				Stack[StackSize++] = Node.Left;
+				Stack[StackSize++] = Node.Right;
+			}
+		}
+
+		if (BestSegment == -1) { return false; }
+
+		OutKey = BestKey;
+		return true;
+	}
+
+	float FSplineSegmentTree::FindInputKeyClosestToWorldLocation(const FVector& WorldLocation) const
+	{
+		float Key = 0;
+		FindInputKeyClosestToWorldLocation(WorldLocation, Key);
+		return Key;
+	}
+
 	FPolyPath::FPolyPath(
 		const TSharedPtr<PCGExData::FPointIO>& InPointIO,
 		const FPCGExGeo2DProjectionDetails& InProjection,
@@ -878,24 +1161,36 @@ namespace PCGExPaths
 		PolyBox += (PolyBoxCenter + FVector(0, 0, ExpandZ));
 		PolyBox += (PolyBoxCenter + FVector(0, 0, -ExpandZ));
 
+		// Large polygons get an acceleration structure; small ones are faster to test directly
+		if (NumPts >= FPolygonSlabs::MinPoints) { Slabs = FPolygonSlabs(ProjectedPoints); }
+
 		if (!Spline)
 		{
 			if (bClosedLoop) { LocalSpline = MakeSplineFromPoints(InTransforms, EPCGExSplinePointTypeRedux::Linear, true, false); }
 			else { LocalSpline = MakeSplineFromPoints(InTransforms, EPCGExSplinePointTypeRedux::Linear, false, false); }
 			Spline = LocalSpline.Get();
 		}
+
+		if (Spline && Spline->GetNumberOfSplineSegments() >= FSplineSegmentTree::MinSegments) { SegmentTree = FSplineSegmentTree(*Spline); }
+	}
+
+	float FPolyPath::FindClosestKey(const FVector& WorldPosition) const
+	{
+		if (SegmentTree.IsValid()) { return SegmentTree.FindInputKeyClosestToWorldLocation(WorldPosition); }
+		return Spline->FindInputKeyClosestToWorldLocation(WorldPosition);
 	}
 
 	bool FPolyPath::IsInsideProjection(const FVector& WorldPosition) const
 	{
 		const FVector ProjectedPoint = Projection.Project(WorldPosition);
 		if (!PolyBox.IsInside(ProjectedPoint)) { return false; }
+		if (Slabs.IsValid()) { return Slabs.IsInside(FVector2D(ProjectedPoint), ProjectedPoints); }
 		return FGeomTools2D::IsPointInPolygon(FVector2D(ProjectedPoint), ProjectedPoints);
 	}
 
 	FTransform FPolyPath::GetClosestTransform(const FVector& WorldPosition, int32& OutEdgeIndex, float& OutLerp, const bool bUseScale) const
 	{
-		const float ClosestKey = Spline->FindInputKeyClosestToWorldLocation(WorldPosition);
+		const float ClosestKey = FindClosestKey(WorldPosition);
 		OutEdgeIndex = FMath::FloorToInt32(ClosestKey);
 		OutLerp = ClosestKey - OutEdgeIndex;
 		return Spline->GetTransformAtSplineInputKey(ClosestKey, ESplineCoordinateSpace::World, bUseScale);
@@ -903,7 +1198,7 @@ namespace PCGExPaths
 
 	FTransform FPolyPath::GetClosestTransform(const FVector& WorldPosition, float& OutAlpha, const bool bUseScale) const
 	{
-		const float ClosestKey = Spline->FindInputKeyClosestToWorldLocation(WorldPosition);
+		const float ClosestKey = FindClosestKey(WorldPosition);
 		OutAlpha = ClosestKey / Spline->GetNumberOfSplineSegments();
 		return Spline->GetTransformAtSplineInputKey(ClosestKey, ESplineCoordinateSpace::World, bUseScale);
 	}
@@ -911,12 +1206,12 @@ namespace PCGExPaths
 	FTransform FPolyPath::GetClosestTransform(const FVector& WorldPosition, bool& bIsInside, const bool bUseScale) const
 	{
 		bIsInside = IsInsideProjection(WorldPosition);
-		return Spline->GetTransformAtSplineInputKey(Spline->FindInputKeyClosestToWorldLocation(WorldPosition), ESplineCoordinateSpace::World, bUseScale);
+		return Spline->GetTransformAtSplineInputKey(FindClosestKey(WorldPosition), ESplineCoordinateSpace::World, bUseScale);
 	}
 
 	FTransform FPolyPath::GetClosestTransform(const FVector& WorldPosition, const bool bUseScale) const
 	{
-		return Spline->GetTransformAtSplineInputKey(Spline->FindInputKeyClosestToWorldLocation(WorldPosition), ESplineCoordinateSpace::World, bUseScale);
+		return Spline->GetTransformAtSplineInputKey(FindClosestKey(WorldPosition), ESplineCoordinateSpace::World, bUseScale);
 	}
 
 	bool FPolyPath::GetClosestPosition(const FVector& WorldPosition, FVector& OutPosition) const
@@ -935,7 +1230,7 @@ namespace PCGExPaths
 
 	int32 FPolyPath::GetClosestEdge(const FVector& WorldPosition, float& OutLerp) const
 	{
-		const float ClosestKey = Spline->FindInputKeyClosestToWorldLocation(WorldPosition);
+		const float ClosestKey = FindClosestKey(WorldPosition);
 		const int32 OutEdgeIndex = FMath::FloorToInt32(ClosestKey);
 		OutLerp = ClosestKey - OutEdgeIndex;
 		return FMath::Min(OutEdgeIndex, this->LastEdge);
@@ -952,6 +1247,97 @@ namespace PCGExPaths
 
 #pragma endregion
 
+	void FPathEdgeBVH::Build(const TArray<TSharedPtr<FPath>>& InPaths, const TFunctionRef<bool(const int32, const int32)>& Filter)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExPaths::FPathEdgeBVH::Build);
+
+		Reset();
+
+		const int32 NumPaths = InPaths.Num();
+		TArray<TArray<FItem>> PerPathItems;
+		PerPathItems.SetNum(NumPaths);
+
+		ParallelFor(
+			NumPaths, [&](const int32 PathIndex)
+			{
+				const TSharedPtr<FPath>& Path = InPaths[PathIndex];
+				if (!Path) { return; }
+
+				TArray<FItem>& PathItems = PerPathItems[PathIndex];
+				PathItems.Reserve(Path->NumEdges);
+
+				for (int32 i = 0; i < Path->NumEdges; i++)
+				{
+					const FPathEdge& Edge = Path->Edges[i];
+					if (!Path->IsEdgeValid(Edge) || !Filter(PathIndex, i)) { continue; }
+
+					FItem& Item = PathItems.Emplace_GetRef();
+					Item.Bounds = Edge.Bounds.GetBox();
+					Item.Path = PathIndex;
+					Item.Edge = i;
+				}
+			}, NumPaths < 8 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+		int32 NumItems = 0;
+		for (const TArray<FItem>& PathItems : PerPathItems) { NumItems += PathItems.Num(); }
+		if (!NumItems) { return; }
+
+		Items.Reserve(NumItems);
+		for (TArray<FItem>& PathItems : PerPathItems)
+		{
+			Items.Append(PathItems);
+			PathItems.Empty();
+		}
+
+		// A balanced tree with N / MaxItemsPerLeaf leaves has at most twice as many nodes
+		Nodes.Reserve(2 * FMath::DivideAndRoundUp(NumItems, MaxItemsPerLeaf));
+		BuildRecursive(0, NumItems);
+	}
+
+	void FPathEdgeBVH::Reset()
+	{
+		Nodes.Empty();
+		Items.Empty();
+	}
+
+	int32 FPathEdgeBVH::BuildRecursive(const int32 Start, const int32 End)
+	{
+		const int32 NodeIndex = Nodes.Emplace();
+
+		FBox Bounds = FBox(ForceInit);
+		FBox CenterBounds = FBox(ForceInit);
+		for (int32 i = Start; i < End; i++)
+		{
+			Bounds += Items[i].Bounds;
+			CenterBounds += Items[i].Bounds.GetCenter();
+		}
+
+		Nodes[NodeIndex].Bounds = Bounds;
+		Nodes[NodeIndex].Start = Start;
+		Nodes[NodeIndex].End = End;
+
+		if (End - Start <= MaxItemsPerLeaf) { return NodeIndex; }
+
+		// Split along the largest spread of edge centers, at the median; long edges would skew a split on full bounds
+		const FVector Size = CenterBounds.GetSize();
+		const int32 Axis = Size.X >= Size.Y ? (Size.X >= Size.Z ? 0 : 2) : (Size.Y >= Size.Z ? 1 : 2);
+		const int32 Mid = Start + (End - Start) / 2;
+
+		FItem* Data = Items.GetData();
+		std::nth_element(
+			Data + Start, Data + Mid, Data + End,
+			[Axis](const FItem& A, const FItem& B) { return A.Bounds.GetCenter()[Axis] < B.Bounds.GetCenter()[Axis]; });
+
+		// Recursion may reallocate Nodes if the reserve estimate was short; don't hold references across it
+		const int32 Left = BuildRecursive(Start, Mid);
+		const int32 Right = BuildRecursive(Mid, End);
+
+		Nodes[NodeIndex].Left = Left;
+		Nodes[NodeIndex].Right = Right;
+
+		return NodeIndex;
+	}
+
 	bool FPathEdgeCrossings::FindSplit(
 		const TSharedPtr<FPath>& Path, const FPathEdge& Edge, const TSharedPtr<FPathEdgeLength>& PathLength,
 		const TSharedPtr<FPath>& OtherPath, const FPathEdge& OtherEdge, const FPCGExPathEdgeIntersectionDetails& InIntersectionDetails)
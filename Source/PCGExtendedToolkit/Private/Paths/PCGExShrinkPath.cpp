@@ -294,6 +294,7 @@ namespace PCGExShrinkPath
 						// Only removed point from the end, no need to copy any data
 						// just update the points count
 						PCGEX_INIT_IO(PointIO, PCGExData::EIOInit::Duplicate)
+						PointIO->MaterializeOutput();
 						PointIO->GetOut()->SetNumPoints(KeptIndices.Num());
 					}
 					else
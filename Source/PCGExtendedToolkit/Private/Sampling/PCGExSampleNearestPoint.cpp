@@ -96,6 +96,13 @@ bool FPCGExSampleNearestPointElement::Boot(FPCGExContext* InContext) const
 
 	Context->TargetsHandler->SetDistances(Settings->DistanceDetails);
 
+	// Unbounded closest/farthest sampling can be answered by a k-d tree instead of a linear scan over every target
+	if ((Settings->SampleMethod == EPCGExSampleMethod::ClosestTarget || Settings->SampleMethod == EPCGExSampleMethod::FarthestTarget) &&
+		Settings->WeightMode == EPCGExSampleWeightMode::Distance)
+	{
+		Context->TargetsHandler->BuildKDTree();
+	}
+
 	if (Settings->SampleMethod == EPCGExSampleMethod::BestCandidate)
 	{
 		Context->Sorter = MakeShared<PCGExSorting::FPointSorter>(PCGExSorting::GetSortingRules(Context, PCGExSorting::SourceSortingRules));
@@ -191,6 +198,8 @@ bool FPCGExSampleNearestPointElement::ExecuteInternal(FPCGContext* InContext) co
 				return;
 			}
 
+			if (Context->Sorter && GetDefault<UPCGExGlobalSettings>()->bPrecomputeSortingKeys) { Context->Sorter->BuildKeys(Context->TargetsHandler->GetFacades()); }
+
 			if (!Context->StartBatchProcessingPoints(
 				[&](const TSharedPtr<PCGExData::FPointIO>& Entry) { return true; },
 				[&](const TSharedPtr<PCGExPointsMT::IBatch>& NewBatch)
@@ -419,6 +428,18 @@ namespace PCGExSampleNearestPoint
 				const FBox Box = FBoxCenterAndExtent(Origin, FVector(FMath::Sqrt(RangeMax))).GetBox();
 				Context->TargetsHandler->FindElementsWithBoundsTest(Box, SampleTarget, &IgnoreList);
 			}
+			else if (Context->TargetsHandler->HasKDTree())
+			{
+				PCGExData::FConstPoint Target;
+				double DistSquared = 0;
+
+				if (Settings->SampleMethod == EPCGExSampleMethod::ClosestTarget ?
+					    Context->TargetsHandler->FindNearestTarget(Point.GetLocation(), Target, DistSquared, &IgnoreList) :
+					    Context->TargetsHandler->FindFarthestTarget(Point.GetLocation(), Target, DistSquared, &IgnoreList))
+				{
+					SampleTarget(Target);
+				}
+			}
 			else
 			{
 				Context->TargetsHandler->ForEachTargetPoint(SampleTarget, &IgnoreList);
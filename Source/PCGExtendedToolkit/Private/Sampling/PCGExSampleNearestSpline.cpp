@@ -106,33 +106,32 @@ bool FPCGExSampleNearestSplineElement::Boot(FPCGExContext* InContext) const
 	Context->Splines.Reserve(Context->NumTargets);
 	for (const UPCGSplineData* SplineData : Context->Targets) { Context->Splines.Add(SplineData->SplineStruct); }
 
-	TArray<FBox> SplineBounds;
+	// Trees point into Splines, which must not reallocate past this point
+	Context->SegmentTrees.Reserve(Context->NumTargets);
+	for (const FPCGSplineStruct& Spline : Context->Splines) { Context->SegmentTrees.Emplace(Spline); }
 
-	SplineBounds.Reserve(Context->NumTargets);
 	Context->SegmentCounts.SetNumUninitialized(Context->NumTargets);
 	Context->Lengths.SetNumUninitialized(Context->NumTargets);
 
-	TArray<FVector> SplinePoints;
 	for (int i = 0; i < Context->NumTargets; i++)
 	{
 		const FPCGSplineStruct& Spline = Context->Targets[i]->SplineStruct;
 		Context->SegmentCounts[i] = Spline.GetNumberOfSplineSegments();
 		Context->Lengths[i] = Spline.GetSplineLength();
 
-		if (Settings->bUseOctree)
-		{
-			Spline.ConvertSplineToPolyLine(ESplineCoordinateSpace::World, FMath::Square(50), SplinePoints);
-
-			FBox& Box = SplineBounds.Emplace_GetRef(ForceInit);
-			for (const FVector& Point : SplinePoints) { Box += Point; }
-			Context->OctreeBounds += Box;
-		}
+		if (Settings->bUseOctree) { Context->OctreeBounds += Context->SegmentTrees[i].GetWorldBounds(); }
 	}
 
 	if (Settings->bUseOctree)
 	{
+		// Segment tree bounds are conservative, unlike a sampled polyline
 		Context->SplineOctree = MakeShared<PCGExOctree::FItemOctree>(Context->OctreeBounds.GetCenter(), Context->OctreeBounds.GetExtent().Length());
-		for (int i = 0; i < Context->NumTargets; i++) { Context->SplineOctree->AddElement(PCGExOctree::FItem(i, SplineBounds[i])); }
+		for (int i = 0; i < Context->NumTargets; i++)
+		{
+			const FBox Bounds = Context->SegmentTrees[i].GetWorldBounds();
+			if (!Bounds.IsValid) { continue; } // Empty spline, nothing to sample
+			Context->SplineOctree->AddElement(PCGExOctree::FItem(i, Bounds));
+		}
 	}
 
 	PCGEX_FOREACH_FIELD_NEARESTPOLYLINE(PCGEX_OUTPUT_VALIDATE_NAME)
@@ -259,6 +258,10 @@ namespace PCGExSampleNearestSpline
 			if (!LookAtUpGetter) { PCGEX_LOG_INVALID_SELECTOR_C(Context, LookAt Up, Settings->LookAtUpSource) }
 		}
 
+		// Out-of-range splines can be skipped outright when nothing else depends on them
+		// (depth accounts for every spline, scaled ranges and bounds-based distances can't be bound ahead of sampling)
+		bCullOutOfRange = !Settings->bWriteDepth && !Settings->bSplineScalesRanges && Settings->DistanceSettings == EPCGExDistance::Center;
+
 		bSingleSample = Settings->SampleMethod != EPCGExSampleMethod::WithinRange;
 		bClosestSample = Settings->SampleMethod != EPCGExSampleMethod::FarthestTarget;
 
@@ -441,10 +444,16 @@ namespace PCGExSampleNearestSpline
 			// First: Sample all valid targets
 			if (!Settings->bSampleSpecificAlpha)
 			{
+				const double MaxRange = bCullOutOfRange && BaseRangeMax > 0 ? BaseRangeMax : MAX_dbl;
+
 				auto ProcessClosestAlpha = [&](const int32 TargetIndex)
 				{
 					const FPCGSplineStruct& Line = Context->Splines[TargetIndex];
-					const double Time = Line.FindInputKeyClosestToWorldLocation(Origin);
+
+					float Key = 0;
+					if (!Context->SegmentTrees[TargetIndex].FindInputKeyClosestToWorldLocation(Origin, Key, MaxRange)) { return; }
+
+					const double Time = Key;
 					ProcessTarget(
 						Line.GetTransformAtSplineInputKey(static_cast<float>(Time), ESplineCoordinateSpace::World, Settings->bSplineScalesRanges),
 						Time, Context->SegmentCounts[TargetIndex], Line);
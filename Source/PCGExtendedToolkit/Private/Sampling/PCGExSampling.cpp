@@ -317,11 +317,13 @@ namespace PCGExSampling
 	void FTargetsHandler::SetDistances(const FPCGExDistanceDetails& InDetails)
 	{
 		Distances = InDetails.MakeDistances();
+		bCenterDistances = InDetails.Source == EPCGExDistance::Center && InDetails.Target == EPCGExDistance::Center;
 	}
 
 	void FTargetsHandler::SetDistances(const EPCGExDistance Source, const EPCGExDistance Target, const bool bOverlapIsZero)
 	{
 		Distances = PCGExDetails::MakeDistances(Source, Target, bOverlapIsZero);
+		bCenterDistances = Source == EPCGExDistance::Center && Target == EPCGExDistance::Center;
 	}
 
 	void FTargetsHandler::SetMatchingDetails(FPCGExContext* InContext, const FPCGExMatchingDetails* InDetails)
@@ -377,7 +379,7 @@ namespace PCGExSampling
 	{
 		for (int i = 0; i < TargetFacades.Num(); i++)
 		{
-			if (Exclude && Exclude->Contains(TargetFacades[i]->GetIn())) { return; }
+			if (Exclude && Exclude->Contains(TargetFacades[i]->GetIn())) { continue; }
 			const int32 NumPoints = TargetFacades[i]->GetNum();
 			for (int j = 0; j < NumPoints; j++) { It(PCGExData::FPoint(j, i)); }
 		}
@@ -388,7 +390,7 @@ namespace PCGExSampling
 		for (int i = 0; i < TargetFacades.Num(); i++)
 		{
 			const TSharedRef<PCGExData::FFacade>& Target = TargetFacades[i];
-			if (Exclude && Exclude->Contains(Target->GetIn())) { return; }
+			if (Exclude && Exclude->Contains(Target->GetIn())) { continue; }
 			const int32 NumPoints = TargetFacades[i]->GetNum();
 			for (int j = 0; j < NumPoints; j++)
 			{
@@ -610,6 +612,83 @@ namespace PCGExSampling
 			});
 	}
 
+	bool FTargetsHandler::BuildKDTree()
+	{
+		if (TargetsKDTree) { return true; }
+		if (!bCenterDistances || TargetFacades.IsEmpty()) { return false; }
+
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExSampling::FTargetsHandler::BuildKDTree);
+
+		int32 NumItems = 0;
+		for (const TSharedRef<PCGExData::FFacade>& Target : TargetFacades) { NumItems += Target->GetNum(); }
+
+		TArray<PCGExKDTree::FItem> Items;
+		Items.Reserve(NumItems);
+
+		for (int i = 0; i < TargetFacades.Num(); i++)
+		{
+			TConstPCGValueRange<FTransform> Transforms = TargetFacades[i]->GetIn()->GetConstTransformValueRange();
+			for (int j = 0; j < Transforms.Num(); j++) { Items.Emplace(Transforms[j].GetLocation(), i, j); }
+		}
+
+		TargetsKDTree = MakeShared<PCGExKDTree::FPointKDTree>(MoveTemp(Items));
+		return true;
+	}
+
+	bool FTargetsHandler::FindNearestTarget(const FVector& Probe, PCGExData::FConstPoint& OutResult, double& OutDistSquared, const TSet<const UPCGData*>* Exclude) const
+	{
+		const int32 Best = Exclude && !Exclude->IsEmpty() ?
+			                   TargetsKDTree->FindNearest(Probe, OutDistSquared, [&](const PCGExKDTree::FItem& Item) { return !Exclude->Contains(TargetFacades[Item.IO]->GetIn()); }) :
+			                   TargetsKDTree->FindNearest(Probe, OutDistSquared);
+
+		if (Best == -1) { return false; }
+
+		const PCGExKDTree::FItem& Item = TargetsKDTree->GetItem(Best);
+		OutResult = GetPoint(Item.IO, Item.Index);
+		OutResult.IO = Item.IO;
+
+		return true;
+	}
+
+	bool FTargetsHandler::FindFarthestTarget(const FVector& Probe, PCGExData::FConstPoint& OutResult, double& OutDistSquared, const TSet<const UPCGData*>* Exclude) const
+	{
+		const int32 Best = Exclude && !Exclude->IsEmpty() ?
+			                   TargetsKDTree->FindFarthest(Probe, OutDistSquared, [&](const PCGExKDTree::FItem& Item) { return !Exclude->Contains(TargetFacades[Item.IO]->GetIn()); }) :
+			                   TargetsKDTree->FindFarthest(Probe, OutDistSquared);
+
+		if (Best == -1) { return false; }
+
+		const PCGExKDTree::FItem& Item = TargetsKDTree->GetItem(Best);
+		OutResult = GetPoint(Item.IO, Item.Index);
+		OutResult.IO = Item.IO;
+
+		return true;
+	}
+
+	void FTargetsHandler::FindKNearestTargets(const FVector& Probe, const int32 K, TArray<PCGExData::FElement>& OutResults, TArray<double>& OutDistSquared, const TSet<const UPCGData*>* Exclude) const
+	{
+		TArray<TPair<int32, double>> Results;
+
+		if (Exclude && !Exclude->IsEmpty())
+		{
+			TargetsKDTree->FindKNearest(Probe, K, Results, [&](const PCGExKDTree::FItem& Item) { return !Exclude->Contains(TargetFacades[Item.IO]->GetIn()); });
+		}
+		else
+		{
+			TargetsKDTree->FindKNearest(Probe, K, Results);
+		}
+
+		OutResults.Reset(Results.Num());
+		OutDistSquared.Reset(Results.Num());
+
+		for (const TPair<int32, double>& Result : Results)
+		{
+			const PCGExKDTree::FItem& Item = TargetsKDTree->GetItem(Result.Key);
+			OutResults.Emplace(Item.Index, Item.IO);
+			OutDistSquared.Add(Result.Value);
+		}
+	}
+
 	double FTargetsHandler::GetDistSquared(const PCGExData::FConstPoint& SourcePoint, const PCGExData::FConstPoint& TargetPoint) const
 	{
 		if (Distances->bOverlapIsZero)
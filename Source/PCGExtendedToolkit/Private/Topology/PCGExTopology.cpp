@@ -4,6 +4,7 @@
 #include "Topology/PCGExTopology.h"
 
 #include "PCGExContext.h"
+#include "Async/ParallelFor.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGExDataTag.h"
 #include "Data/PCGExPointElements.h"
@@ -134,6 +135,84 @@ namespace PCGExTopology
 		}
 	}
 
+	void FHalfEdgeGraph::Build(const TSharedRef<PCGExCluster::FCluster>& InCluster, const TArray<FVector2D>& ProjectedPositions)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExTopology::FHalfEdgeGraph::Build);
+
+		const int32 NumEdges = InCluster->Edges->Num();
+		const int32 NumHalfEdges = NumEdges * 2;
+
+		Origin.SetNumUninitialized(NumHalfEdges);
+		Next.Init(-1, NumHalfEdges);
+		Face.Init(-1, NumHalfEdges);
+		Faces.Reset();
+
+		for (int32 i = 0; i < NumEdges; i++)
+		{
+			Origin[i * 2] = InCluster->GetEdgeStart(i)->Index;
+			Origin[i * 2 + 1] = InCluster->GetEdgeEnd(i)->Index;
+		}
+
+		// Sort outgoing half-edges around each node, counter-clockwise.
+		// Each node only writes Next for the half-edges arriving to it, so nodes are independent.
+		const TArray<PCGExCluster::FNode>& ClusterNodes = *InCluster->Nodes.Get();
+		const int32 NumNodes = ClusterNodes.Num();
+
+		ParallelFor(
+			NumNodes, [&](const int32 NodeIndex)
+			{
+				const PCGExCluster::FNode& Node = ClusterNodes[NodeIndex];
+				const int32 NumLinks = Node.Links.Num();
+				if (!NumLinks) { return; }
+
+				const FVector2D PP = ProjectedPositions[Node.PointIndex];
+
+				TArray<TPair<double, int32>, TInlineAllocator<16>> Outgoing;
+				Outgoing.Reserve(NumLinks);
+
+				for (const PCGExGraph::FLink Lk : Node.Links)
+				{
+					const int32 HalfEdge = Origin[Lk.Edge * 2] == NodeIndex ? Lk.Edge * 2 : Lk.Edge * 2 + 1;
+					const FVector2D Dir = ProjectedPositions[InCluster->GetNodePointIndex(Lk)] - PP;
+					Outgoing.Emplace(FMath::Atan2(Dir.Y, Dir.X), HalfEdge);
+				}
+
+				Outgoing.Sort([](const TPair<double, int32>& A, const TPair<double, int32>& B) { return A.Key < B.Key || (A.Key == B.Key && A.Value < B.Value); });
+
+				// Arriving through the twin of an outgoing half-edge, leave through the first one clockwise from it.
+				// This matches the tightest turn picked by FCell::BuildFromCluster; leaves bounce back on themselves.
+				for (int32 i = 0; i < NumLinks; i++)
+				{
+					const int32 Out = Outgoing[i].Value;
+					Next[GetTwin(Out)] = Outgoing[i == 0 ? NumLinks - 1 : i - 1].Value;
+				}
+			}, NumNodes < 1024 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+		// Next is a permutation; label its cycles. Linear, pointer-chasing only.
+		for (int32 i = 0; i < NumHalfEdges; i++)
+		{
+			if (Face[i] != -1 || Next[i] == -1) { continue; }
+
+			const int32 FaceIndex = Faces.Add(i);
+			int32 HalfEdge = i;
+			do
+			{
+				Face[HalfEdge] = FaceIndex;
+				HalfEdge = Next[HalfEdge];
+			}
+			while (HalfEdge != i && HalfEdge != -1);
+		}
+	}
+
+	int32 FHalfEdgeGraph::FindHalfEdge(const PCGExGraph::FLink InLink) const
+	{
+		const int32 HalfEdge = InLink.Edge * 2;
+		if (!Origin.IsValidIndex(HalfEdge + 1)) { return -1; }
+		if (Origin[HalfEdge] == InLink.Node) { return HalfEdge; }
+		if (Origin[HalfEdge + 1] == InLink.Node) { return HalfEdge + 1; }
+		return -1;
+	}
+
 	bool FCellConstraints::ContainsSignedEdgeHash(const uint64 Hash) const
 	{
 		FReadScopeLock ReadScopeLock(UniqueStartHalfEdgesHashLock);
@@ -386,13 +465,100 @@ namespace PCGExTopology
 			}
 		}
 
+		return CompleteBuild(InCluster, ProjectedPositions, Metrics, NumUniqueNodes, true);
+	}
+
+	ECellResult FCell::BuildFromFace(
+		const FHalfEdgeGraph& InHalfEdges,
+		const int32 InFace,
+		const TSharedRef<PCGExCluster::FCluster>& InCluster,
+		const TArray<FVector2D>& ProjectedPositions)
+	{
+		bBuiltSuccessfully = false;
+		Data.Bounds = FBox(ForceInit);
+
+		const int32 SeedHalfEdge = InHalfEdges.Faces[InFace];
+		Seed = PCGExGraph::FLink(InHalfEdges.Origin[SeedHalfEdge], FHalfEdgeGraph::GetEdge(SeedHalfEdge));
+
+		const FVector SeedRP = InCluster->GetPos(Seed.Node);
+
+		PCGExPaths::FPathMetrics Metrics = PCGExPaths::FPathMetrics(SeedRP);
+		Data.Centroid = SeedRP;
+		Data.Bounds += SeedRP;
+
+		Nodes.Add(Seed.Node);
+		if (InCluster->GetNode(Seed.Node)->IsLeaf() && Constraints->bDuplicateLeafPoints) { Nodes.Add(Seed.Node); }
+
+		int32 NumUniqueNodes = 1;
+
+		// Same steps as the BuildFromCluster walk, down to revisiting the seed node before closing, so both yield identical cells
+		const int32 FailSafe = InHalfEdges.Num();
+		int32 NumSteps = 0;
+		int32 HalfEdge = SeedHalfEdge;
+
+		do
+		{
+			if (++NumSteps > FailSafe) { return ECellResult::MalformedCluster; }
+
+			const PCGExCluster::FNode* Current = InCluster->GetNode(InHalfEdges.GetDestination(HalfEdge));
+
+			Nodes.Add(Current->Index);
+			NumUniqueNodes++;
+
+			const FVector& RP = InCluster->GetPos(Current);
+			Data.Centroid += RP;
+
+			double SegmentLength = 0;
+			const double NewLength = Metrics.Add(RP, SegmentLength);
+			if (NewLength > Constraints->MaxPerimeter) { return ECellResult::OutsidePerimeterLimit; }
+			if (SegmentLength < Constraints->MinSegmentLength || SegmentLength > Constraints->MaxSegmentLength) { return ECellResult::OutsideSegmentsLimit; }
+
+			if (NumUniqueNodes > Constraints->MaxPointCount) { return ECellResult::OutsidePointsLimit; }
+
+			Data.Bounds += RP;
+			if (Data.Bounds.GetSize().Length() > Constraints->MaxBoundsSize) { return ECellResult::OutsideBoundsLimit; }
+
+			if (Current->IsLeaf() && Constraints->bDuplicateLeafPoints) { Nodes.Add(Current->Index); }
+
+			HalfEdge = InHalfEdges.Next[HalfEdge];
+
+			if (InCluster->GetNode(InHalfEdges.GetDestination(HalfEdge))->Num() == 1 && !Constraints->bKeepCellsWithLeaves) { return ECellResult::Leaf; }
+			if (NumUniqueNodes > Constraints->MaxPointCount) { return ECellResult::OutsideBoundsLimit; }
+
+			if (NumUniqueNodes > 2)
+			{
+				PCGExMath::CheckConvex(
+					InCluster->GetPos(Nodes.Last(2)),
+					InCluster->GetPos(Nodes.Last(1)),
+					InCluster->GetPos(Nodes.Last()),
+					Data.bIsConvex, Sign);
+
+				if (Constraints->bConvexOnly && !Data.bIsConvex) { return ECellResult::WrongAspect; }
+			}
+		}
+		while (HalfEdge != SeedHalfEdge);
+
+		Data.bIsClosedLoop = true;
+		const int32 RemovedIndex = Nodes.Pop();            // Remove seed node, added again when closing
+		if (RemovedIndex == Nodes.Last()) { Nodes.Pop(); } // Remove last if duplicate (leaf)
+
+		return CompleteBuild(InCluster, ProjectedPositions, Metrics, NumUniqueNodes, false);
+	}
+
+	ECellResult FCell::CompleteBuild(
+		const TSharedRef<PCGExCluster::FCluster>& InCluster,
+		const TArray<FVector2D>& ProjectedPositions,
+		const PCGExPaths::FPathMetrics& Metrics,
+		const int32 NumUniqueNodes,
+		const bool bDeduplicate)
+	{
 		if (NumUniqueNodes <= 2) { return ECellResult::Leaf; }
 
 		if (!Data.bIsClosedLoop) { return ECellResult::OpenCell; }
 
 		PCGEx::ShiftArrayToSmallest(Nodes); // ! important to guarantee contour determinism
 
-		if (!Constraints->IsUniqueCellHash(SharedThis(this))) { return ECellResult::Duplicate; }
+		if (bDeduplicate && !Constraints->IsUniqueCellHash(SharedThis(this))) { return ECellResult::Duplicate; }
 
 		bBuiltSuccessfully = true;
 
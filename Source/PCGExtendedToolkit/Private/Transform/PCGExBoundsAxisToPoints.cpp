@@ -79,6 +79,7 @@ namespace PCGExBoundsAxisToPoints
 		}
 		else
 		{
+			PointDataFacade->Source->MaterializeOutput();
 			PCGEx::SetNumPointsAllocated(PointDataFacade->GetOut(), NumPoints * 2);
 			PointDataFacade->Source->InheritProperties(0, NumPoints, NumPoints);
 		}
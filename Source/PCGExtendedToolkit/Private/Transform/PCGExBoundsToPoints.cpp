@@ -91,6 +91,7 @@ namespace PCGExBoundsToPoints
 		{
 			if (bSymmetry)
 			{
+				PointDataFacade->Source->MaterializeOutput();
 				PCGEx::SetNumPointsAllocated(PointDataFacade->GetOut(), NumPoints * 2);
 				PointDataFacade->Source->InheritProperties(0, NumPoints, NumPoints);
 			}
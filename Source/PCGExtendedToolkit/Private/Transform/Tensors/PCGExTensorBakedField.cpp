@@ -0,0 +1,118 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Transform/Tensors/PCGExTensorBakedField.h"
+
+namespace PCGExTensor
+{
+	FBakedField::FBakedField(const double InCellSize, const int32 InMaxBricks)
+		: CellSize(FMath::Max(InCellSize, UE_KINDA_SMALL_NUMBER)), MaxBricks(InMaxBricks)
+	{
+		InvCellSize = 1.0 / CellSize;
+	}
+
+	bool FBakedField::Sample(const FVector& InPosition, FTensorSample& OutSample, FEvaluateFunc&& Evaluate) const
+	{
+		const FVector Grid = InPosition * InvCellSize;
+		const FIntVector Cell = FIntVector(FMath::FloorToInt32(Grid.X), FMath::FloorToInt32(Grid.Y), FMath::FloorToInt32(Grid.Z));
+		const FIntVector Key = FIntVector(
+			FMath::FloorToInt32(static_cast<double>(Cell.X) / BrickCells),
+			FMath::FloorToInt32(static_cast<double>(Cell.Y) / BrickCells),
+			FMath::FloorToInt32(static_cast<double>(Cell.Z) / BrickCells));
+
+		const FBrick* Brick = GetOrBakeBrick(Key, Evaluate);
+		if (!Brick) { return false; }
+
+		const FIntVector Local = Cell - Key * BrickCells;
+		const FVector T = Grid - FVector(Cell);
+
+		FVector DirectionAndSize = FVector::ZeroVector;
+		FQuat Rotation = FQuat(0, 0, 0, 0);
+		FQuat Reference = FQuat::Identity;
+		double Weight = 0;
+		int32 Effectors = MAX_int32;
+
+		for (int32 i = 0; i < 8; i++)
+		{
+			const int32 DX = i & 1;
+			const int32 DY = (i >> 1) & 1;
+			const int32 DZ = (i >> 2) & 1;
+
+			const FTensorSample& Corner = Brick->Samples[
+				((Local.X + DX) * BrickSamples + (Local.Y + DY)) * BrickSamples + (Local.Z + DZ)];
+
+			// Partially covered cell; interpolating towards an empty corner would bleed the field outside its actual bounds
+			if (Corner.Effectors == 0) { return false; }
+
+			const double W =
+				(DX ? T.X : 1 - T.X) *
+				(DY ? T.Y : 1 - T.Y) *
+				(DZ ? T.Z : 1 - T.Z);
+
+			DirectionAndSize += Corner.DirectionAndSize * W;
+			Weight += Corner.Weight * W;
+			Effectors = FMath::Min(Effectors, Corner.Effectors);
+
+			// Weighted nlerp, keeping every quaternion in the same hemisphere
+			if (i == 0) { Reference = Corner.Rotation; }
+			Rotation += (Corner.Rotation | Reference) < 0 ? Corner.Rotation * -W : Corner.Rotation * W;
+		}
+
+		Rotation.Normalize();
+
+		OutSample.DirectionAndSize = DirectionAndSize;
+		OutSample.Rotation = Rotation;
+		OutSample.Effectors = Effectors;
+		OutSample.Weight = Weight;
+
+		return true;
+	}
+
+	const FBakedField::FBrick* FBakedField::GetOrBakeBrick(const FIntVector& InKey, FEvaluateFunc& Evaluate) const
+	{
+		{
+			FReadScopeLock ReadScopeLock(BricksLock);
+			if (const TSharedPtr<FBrick>* Existing = Bricks.Find(InKey)) { return Existing->Get(); }
+		}
+
+		// Reserve a slot in the budget before doing the actual work
+		if (NumBricks.fetch_add(1) >= MaxBricks)
+		{
+			NumBricks.fetch_sub(1);
+			return nullptr;
+		}
+
+		TRACE_CPUPROFILER_EVENT_SCOPE(FBakedField::BakeBrick);
+
+		PCGEX_MAKE_SHARED(NewBrick, FBrick)
+		NewBrick->Samples.SetNumUninitialized(BrickSamples * BrickSamples * BrickSamples);
+
+		const FVector Origin = FVector(InKey * BrickCells) * CellSize;
+
+		int32 Index = 0;
+		for (int32 X = 0; X < BrickSamples; X++)
+		{
+			for (int32 Y = 0; Y < BrickSamples; Y++)
+			{
+				for (int32 Z = 0; Z < BrickSamples; Z++)
+				{
+					NewBrick->Samples[Index++] = Evaluate(Origin + FVector(X, Y, Z) * CellSize);
+				}
+			}
+		}
+
+		{
+			FWriteScopeLock WriteScopeLock(BricksLock);
+			if (const TSharedPtr<FBrick>* Existing = Bricks.Find(InKey))
+			{
+				// Another thread baked the same brick in the meantime; give our slot back
+				NumBricks.fetch_sub(1);
+				return Existing->Get();
+			}
+
+			Bricks.Add(InKey, NewBrick);
+		}
+
+		return NewBrick.Get();
+	}
+}
@@ -48,6 +48,21 @@ namespace PCGExTensor
 		// Fwd settings
 		SamplerInstance->Radius = Config.SamplerSettings.Radius;
 
+		if (Config.bBakeField)
+		{
+			bool bCanBake = true;
+			for (const TSharedPtr<PCGExTensorOperation>& Op : Tensors)
+			{
+				if (!Op->IsBakeable())
+				{
+					bCanBake = false;
+					break;
+				}
+			}
+
+			if (bCanBake) { SamplerInstance->BakedField = MakeShared<FBakedField>(Config.BakeCellSize, Config.MaxBakedBricks); }
+		}
+
 		return SamplerInstance->PrepareForData(InContext);
 	}
 
@@ -22,6 +22,22 @@ PCGExTensor::FTensorSample UPCGExTensorSampler::RawSample(const TArray<TSharedPt
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UPCGExTensorSampler::RawSample);
 
+	if (BakedField)
+	{
+		PCGExTensor::FTensorSample Baked;
+		if (BakedField->Sample(
+			InProbe.GetLocation(), Baked,
+			[&](const FVector& InPosition) { return AnalyticSample(InTensors, InSeedIndex, FTransform(InPosition)); }))
+		{
+			return Baked;
+		}
+	}
+
+	return AnalyticSample(InTensors, InSeedIndex, InProbe);
+}
+
+PCGExTensor::FTensorSample UPCGExTensorSampler::AnalyticSample(const TArray<TSharedPtr<PCGExTensorOperation>>& InTensors, const int32 InSeedIndex, const FTransform& InProbe) const
+{
 	PCGExTensor::FTensorSample Result = PCGExTensor::FTensorSample();
 
 	TArray<PCGExTensor::FTensorSample> Samples;
@@ -159,6 +159,8 @@ namespace PCGExAssetStaging
 		FPCGExFittingVariationsDetails Variations;
 
 		TSharedPtr<PCGExStaging::TDistributionHelper<UPCGExAssetCollection, FPCGExAssetCollectionEntry>> Helper;
+		TArray<int32> PointSeeds; // Only used with bulk picks
+		TArray<int32> EntryPicks; // Only used with bulk picks
 
 		TSharedPtr<PCGExData::TBuffer<int32>> WeightWriter;
 		TSharedPtr<PCGExData::TBuffer<double>> NormalizedWeightWriter;
@@ -108,6 +108,21 @@ namespace PCGExStaging
 			TypedCollection = InCollection;
 		}
 
+		/** Whether the top-level pick only depends on the point seed, so it can be made for a whole scope at once with GetPicks. */
+		FORCEINLINE bool SupportsBulkPicks() const { return !CategoryGetter && Details.Distribution == EPCGExDistribution::WeightedRandom; }
+
+		/** Top-level weighted picks for every point in the scope, resolved later with GetEntryFromPick. Seeds and OutPicks are indexed by point. */
+		void GetPicks(const PCGExMT::FScope& Scope, TConstArrayView<int32> Seeds, TArrayView<int32> OutPicks) const
+		{
+			Cache->Main->GetPickRandomWeighted(Scope, Seeds, OutPicks);
+		}
+
+		/** Equivalent to GetEntry when SupportsBulkPicks, from a pick made by GetPicks. */
+		void GetEntryFromPick(const A*& OutEntry, const int32 Pick, const int32 Seed, const UPCGExAssetCollection*& OutHost) const
+		{
+			if (!TypedCollection->GetEntryFromWeightedPick(OutEntry, Pick, Seed, OutHost)) { OutEntry = nullptr; }
+		}
+
 		void GetEntry(const A*& OutEntry, const int32 PointIndex, const int32 Seed, const UPCGExAssetCollection*& OutHost) const
 		{
 			TSharedPtr<PCGExAssetCollection::FCategory> Category = Cache->Main;
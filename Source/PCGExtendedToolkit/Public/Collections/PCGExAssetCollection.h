@@ -12,6 +12,7 @@
 #endif
 
 #include "PCGExDetailsData.h"
+#include "PCGExRandom.h"
 #include "Data/PCGExAttributeHelpers.h"
 #include "Data/PCGExData.h"
 #include "Transform/PCGExTransform.h"
@@ -29,6 +30,8 @@ virtual bool GetEntryRandom(const FPCGExAssetCollectionEntry*& OutEntry, const i
 const _ENTRY_TYPE* OutTypedEntry = static_cast<const _ENTRY_TYPE*>(OutEntry); if(GetEntryRandomTpl(OutTypedEntry, Entries, Seed, OutHost)){ OutEntry = static_cast<const FPCGExAssetCollectionEntry*>(OutTypedEntry);  return true;} return false; }\
 virtual bool GetEntryWeightedRandom(const FPCGExAssetCollectionEntry*& OutEntry, const int32 Seed, const UPCGExAssetCollection*& OutHost) override {\
 const _ENTRY_TYPE* OutTypedEntry = static_cast<const _ENTRY_TYPE*>(OutEntry); if(GetEntryWeightedRandomTpl(OutTypedEntry, Entries, Seed, OutHost)){ OutEntry = static_cast<const FPCGExAssetCollectionEntry*>(OutTypedEntry);  return true;} return false; }\
+virtual bool GetEntryFromWeightedPick(const FPCGExAssetCollectionEntry*& OutEntry, const int32 PickedIndex, const int32 Seed, const UPCGExAssetCollection*& OutHost) override {\
+const _ENTRY_TYPE* OutTypedEntry = static_cast<const _ENTRY_TYPE*>(OutEntry); if(GetEntryFromWeightedPickTpl(OutTypedEntry, Entries, PickedIndex, Seed, OutHost)){ OutEntry = static_cast<const FPCGExAssetCollectionEntry*>(OutTypedEntry);  return true;} return false; }\
 virtual bool GetEntryAt(const FPCGExAssetCollectionEntry*& OutEntry, const int32 Index, uint8 TagInheritance, TSet<FName>& OutTags, const UPCGExAssetCollection*& OutHost) override{\
 const _ENTRY_TYPE* OutTypedEntry = static_cast<const _ENTRY_TYPE*>(OutEntry); if(GetEntryAtTpl(OutTypedEntry, Entries, Index, TagInheritance, OutTags, OutHost)){ OutEntry = static_cast<const FPCGExAssetCollectionEntry*>(OutTypedEntry);  return true;} return false; }\
 virtual bool GetEntry(const FPCGExAssetCollectionEntry*& OutEntry, const int32 Index, const int32 Seed, const EPCGExIndexPickMode PickMode, uint8 TagInheritance, TSet<FName>& OutTags, const UPCGExAssetCollection*& OutHost) override{\
@@ -43,6 +46,7 @@ bool GetEntryAt(const _ENTRY_TYPE*& OutEntry, const int32 Index, const UPCGExAss
 bool GetEntry(const _ENTRY_TYPE*& OutEntry, const int32 Index, int32 Seed, const EPCGExIndexPickMode PickMode, const UPCGExAssetCollection*& OutHost) { return GetEntryTpl(OutEntry, Entries, Index, Seed, PickMode, OutHost); }\
 bool GetEntryRandom(const _ENTRY_TYPE*& OutEntry, const int32 Seed, const UPCGExAssetCollection*& OutHost) { return GetEntryRandomTpl(OutEntry, Entries, Seed, OutHost); }\
 bool GetEntryWeightedRandom(const _ENTRY_TYPE*& OutEntry, const int32 Seed, const UPCGExAssetCollection*& OutHost) { return GetEntryWeightedRandomTpl(OutEntry, Entries, Seed, OutHost); }\
+bool GetEntryFromWeightedPick(const _ENTRY_TYPE*& OutEntry, const int32 PickedIndex, const int32 Seed, const UPCGExAssetCollection*& OutHost) { return GetEntryFromWeightedPickTpl(OutEntry, Entries, PickedIndex, Seed, OutHost); }\
 bool GetEntryAt(const _ENTRY_TYPE*& OutEntry, const int32 Index, uint8 TagInheritance, TSet<FName>& OutTags, const UPCGExAssetCollection*& OutHost) { return GetEntryAtTpl(OutEntry, Entries, Index, TagInheritance, OutTags, OutHost); }\
 bool GetEntry(const _ENTRY_TYPE*& OutEntry, const int32 Index, const int32 Seed, const EPCGExIndexPickMode PickMode, uint8 TagInheritance, TSet<FName>& OutTags, const UPCGExAssetCollection*& OutHost) { return GetEntryTpl(OutEntry, Entries, Index, Seed, PickMode, TagInheritance, OutTags, OutHost); }\
 bool GetEntryRandom(const _ENTRY_TYPE*& OutEntry, const int32 Seed, uint8 TagInheritance, TSet<FName>& OutTags, const UPCGExAssetCollection*& OutHost) { return GetEntryRandomTpl(OutEntry, Entries, Seed, TagInheritance, OutTags, OutHost); }\
@@ -411,6 +415,31 @@ protected:
 
 namespace PCGExAssetCollection
 {
+	/**
+	 * Vose alias table over integer weights.
+	 * Built in O(n), picks are O(1) and integer-only, so a given seed always lands on the same column.
+	 */
+	struct PCGEXTENDEDTOOLKIT_API FAliasTable
+	{
+		TArray<uint32> Thresholds; // A roll below the threshold keeps the column, otherwise it goes to the alias
+		TArray<int32> Aliases;
+		uint32 Capacity = 0; // Total weight, every column holds exactly that much
+
+		FORCEINLINE bool IsEmpty() const { return Aliases.IsEmpty(); }
+		FORCEINLINE int32 Num() const { return Aliases.Num(); }
+
+		void Build(TConstArrayView<int32> InWeights);
+
+		FORCEINLINE int32 Pick(const int32 Seed) const
+		{
+			// High bits pick the column, low bits roll against its threshold
+			const uint64 H = PCGExRandom::HashSeed(Seed);
+			const int32 Column = static_cast<int32>(((H >> 32) * static_cast<uint64>(Aliases.Num())) >> 32);
+			const uint32 Roll = static_cast<uint32>(((H & 0xFFFFFFFFull) * Capacity) >> 32);
+			return Roll < Thresholds[Column] ? Column : Aliases[Column];
+		}
+	};
+
 	class PCGEXTENDEDTOOLKIT_API FCategory : public TSharedFromThis<FCategory>
 	{
 	public:
@@ -419,6 +448,7 @@ namespace PCGExAssetCollection
 		TArray<int32> Indices;
 		TArray<int32> Weights;
 		TArray<int32> Order;
+		FAliasTable AliasTable; // Over Order, built from the sorted weights
 		TArray<const FPCGExAssetCollectionEntry*> Entries;
 
 		FCategory()
@@ -444,6 +474,9 @@ namespace PCGExAssetCollection
 		int32 GetPickRandom(const int32 Seed) const;
 		int32 GetPickRandomWeighted(const int32 Seed) const;
 
+		/** Weighted random pick for every point in the scope. Seeds and OutPicks are indexed by point. */
+		void GetPickRandomWeighted(const PCGExMT::FScope& Scope, TConstArrayView<int32> Seeds, TArrayView<int32> OutPicks) const;
+
 		void Reserve(const int32 Num);
 		void Shrink();
 
@@ -694,6 +727,10 @@ public:
 	virtual bool GetEntryWeightedRandom(const FPCGExAssetCollectionEntry*& OutEntry, const int32 Seed, const UPCGExAssetCollection*& OutHost)
 	PCGEX_NOT_IMPLEMENTED_RET(GetEntryWeightedRandom, false)
 
+	/** Same as GetEntryWeightedRandom, from a pick already made against the main category (see FCategory bulk picks). */
+	virtual bool GetEntryFromWeightedPick(const FPCGExAssetCollectionEntry*& OutEntry, const int32 PickedIndex, const int32 Seed, const UPCGExAssetCollection*& OutHost)
+	PCGEX_NOT_IMPLEMENTED_RET(GetEntryFromWeightedPick, false)
+
 
 	virtual bool GetEntryAt(const FPCGExAssetCollectionEntry*& OutEntry, const int32 Index, uint8 TagInheritance, TSet<FName>& OutTags, const UPCGExAssetCollection*& OutHost)
 	PCGEX_NOT_IMPLEMENTED_RET(GetEntryAt, false)
@@ -791,7 +828,17 @@ protected:
 		const int32 Seed,
 		const UPCGExAssetCollection*& OutHost)
 	{
-		const int32 PickedIndex = LoadCache()->Main->GetPickRandomWeighted(Seed);
+		return GetEntryFromWeightedPickTpl(OutEntry, InEntries, LoadCache()->Main->GetPickRandomWeighted(Seed), Seed, OutHost);
+	}
+
+	template <typename T>
+	bool GetEntryFromWeightedPickTpl(
+		const T*& OutEntry,
+		const TArray<T>& InEntries,
+		const int32 PickedIndex,
+		const int32 Seed,
+		const UPCGExAssetCollection*& OutHost)
+	{
 		if (!InEntries.IsValidIndex(PickedIndex)) { return false; }
 
 		const T& Entry = InEntries[PickedIndex];
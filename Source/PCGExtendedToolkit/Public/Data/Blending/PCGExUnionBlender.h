@@ -74,6 +74,9 @@ namespace PCGExDataBlending
 		TSet<FString> TypeMismatches;
 		bool Validate(FPCGExContext* InContext, const bool bQuiet) const;
 
+		// Weights straight from the flat union layout, using pre-resolved source indices
+		int32 ComputeFlatWeights(const int32 UnionIndex, TArray<PCGExData::FWeightedPoint>& OutWeightedPoints) const;
+
 		bool bPreserveAttributesDefaultValue = false;
 		const FPCGExBlendingDetails* BlendingDetails = nullptr;
 		const TSharedPtr<PCGExDetails::FDistances> DistanceDetails = nullptr;
@@ -91,5 +94,8 @@ namespace PCGExDataBlending
 
 		TSharedPtr<PCGExData::FUnionMetadata> CurrentUnionMetadata;
 		TSharedPtr<PCGExData::FFacade> CurrentTargetData;
+
+		// Source index of each CurrentUnionMetadata->FlatElements, -1 if that IO isn't a source. Empty if metadata isn't flat.
+		TArray<int32> FlatSources;
 	};
 }
@@ -150,6 +150,9 @@ extern template bool IBuffer::IsA<_TYPE>() const;
 		// Unsafe read from input
 		virtual const T& Read(const int32 Index) const = 0;
 
+		// Unsafe bulk read from input, OutValues[i] = Read(Scope.Start + i)
+		virtual void ReadScope(const PCGExMT::FScope& Scope, TArrayView<T> OutValues) const;
+
 		// Unsafe read from output
 		virtual const T& GetValue(const int32 Index) = 0;
 
@@ -203,6 +206,7 @@ extern template bool IBuffer::IsA<_TYPE>() const;
 		virtual bool ReadsFromOutput() override;
 
 		virtual const T& Read(const int32 Index) const override;
+		virtual void ReadScope(const PCGExMT::FScope& Scope, TArrayView<T> OutValues) const override;
 		virtual const T& GetValue(const int32 Index) override;
 		virtual void SetValue(const int32 Index, const T& Value) override;
 
@@ -248,6 +252,7 @@ extern template bool IBuffer::IsA<_TYPE>() const;
 		virtual bool ReadsFromOutput() override;
 
 		virtual const T& Read(const int32 Index) const override;
+		virtual void ReadScope(const PCGExMT::FScope& Scope, TArrayView<T> OutValues) const override;
 		virtual const T& GetValue(const int32 Index) override;
 		virtual void SetValue(const int32 Index, const T& Value) override;
 
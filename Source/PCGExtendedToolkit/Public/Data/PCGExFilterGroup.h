@@ -150,6 +150,8 @@ namespace PCGExFilterGroup
 			for (const TSharedPtr<PCGExPointFilter::IFilter>& Filter : ManagedFilters) { if (!Filter->Test(IO, ParentCollection)) { return bInvert; } }
 			return !bInvert;
 		}
+
+		virtual void TestRange(const PCGExMT::FScope& Scope, TArrayView<int8> InOutMask) const override;
 	};
 
 	class PCGEXTENDEDTOOLKIT_API FFilterGroupOR final : public FFilterGroup
@@ -189,5 +191,7 @@ namespace PCGExFilterGroup
 			for (const TSharedPtr<PCGExPointFilter::IFilter>& Filter : ManagedFilters) { if (Filter->Test(IO, ParentCollection)) { return !bInvert; } }
 			return bInvert;
 		}
+
+		virtual void TestRange(const PCGExMT::FScope& Scope, TArrayView<int8> InOutMask) const override;
 	};
 }
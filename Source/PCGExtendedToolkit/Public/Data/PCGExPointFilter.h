@@ -125,6 +125,12 @@ namespace PCGExPointFilter
 	const FName OutputInsideFiltersLabel = FName("Inside");
 	const FName OutputOutsideFiltersLabel = FName("Outside");
 
+	FORCEINLINE static bool AnyPass(const TConstArrayView<int8> InMask)
+	{
+		for (const int8 Lane : InMask) { if (Lane) { return true; } }
+		return false;
+	}
+
 	class PCGEXTENDEDTOOLKIT_API IFilter : public TSharedFromThis<IFilter>
 	{
 	public:
@@ -158,6 +164,12 @@ namespace PCGExPointFilter
 
 		virtual bool Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const; // destined for collection only, is expected to test internal PointDataFacade directly.
 
+		/**
+		 * Columnar Test(Index) over a contiguous scope, ANDed into the mask: InOutMask[i] &= Test(Scope.Start + i).
+		 * Lanes already at 0 may be skipped. Default implementation dispatches Test(Index) on live lanes only.
+		 */
+		virtual void TestRange(const PCGExMT::FScope& Scope, TArrayView<int8> InOutMask) const;
+
 		virtual void SetSupportedTypes(const TSet<PCGExFactories::EType>* InTypes)
 		{
 		}
@@ -197,6 +209,8 @@ namespace PCGExPointFilter
 		virtual bool Test(const PCGExCluster::FNode& Node) const override final;
 		virtual bool Test(const PCGExGraph::FEdge& Edge) const override final;
 		virtual bool Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const override;
+
+		virtual void TestRange(const PCGExMT::FScope& Scope, TArrayView<int8> InOutMask) const override;
 	};
 
 	class PCGEXTENDEDTOOLKIT_API FManager : public TSharedFromThis<FManager>
@@ -245,6 +259,9 @@ namespace PCGExPointFilter
 		virtual void PostInitFilter(FPCGExContext* InContext, const TSharedPtr<IFilter>& InFilter);
 
 		virtual void InitCache();
+
+		// Resets the mask and ANDs every filter into it, stopping early once the whole scope has failed. Returns the number of passing points.
+		int32 TestRange(const PCGExMT::FScope& Scope, TArrayView<int8> OutMask) const;
 	};
 
 	static void RegisterBuffersDependencies(FPCGExContext* InContext, const TArray<TObjectPtr<const UPCGExFilterFactoryData>>& InFactories, PCGExData::FFacadePreloader& FacadePreloader)
@@ -57,6 +57,9 @@ namespace PCGExData
 		mutable FRWLock OutKeysLock;
 		mutable FRWLock AttributesLock;
 		mutable FRWLock IdxMappingLock;
+		mutable FRWLock InheritedOutputLock;
+
+		mutable std::atomic<bool> bInheritedOutput{false}; // Out still references In's properties & metadata, see MaterializeOutput
 
 		bool bWritten = false;
 		int32 NumInPoints = -1;
@@ -96,6 +99,16 @@ namespace PCGExData
 
 		bool InitializeOutput(EIOInit InitOut = EIOInit::NoInit);
 
+		/** Whether EIOInit::Duplicate can inherit from the given data rather than deep-copying it. See UPCGExGlobalSettings::bCopyOnWriteDuplicate */
+		static bool CanInheritOnDuplicate(const UPCGBasePointData* InData);
+
+		/**
+		 * Flattens an output that still inherits from the input, so it owns all its properties & metadata.
+		 * Must be called before resizing the output, removing points or deleting attributes from it. No-op otherwise.
+		 * FPointIO structural helpers (InheritPoints, Gather, DeleteAttribute...) already do it.
+		 */
+		void MaterializeOutput() const;
+
 		template <typename T>
 		bool InitializeOutput(const EIOInit InitOut = EIOInit::NoInit)
 		{
@@ -113,6 +126,8 @@ namespace PCGExData
 				Out = nullptr;
 			}
 
+			bInheritedOutput = false;
+
 			if (InitOut == EIOInit::NoInit)
 			{
 				bMutable = false;
@@ -144,19 +159,23 @@ namespace PCGExData
 			{
 				check(In)
 
-				if (const T* TypedIn = Cast<T>(In))
+				const T* TypedIn = Cast<T>(In);
+				if (TypedIn && !CanInheritOnDuplicate(In))
 				{
 					T* TypedOut = SharedContext.Get()->ManagedObjects->DuplicateData<T>(TypedIn);
 					Out = Cast<UPCGBasePointData>(TypedOut);
 				}
 				else
 				{
+					// Type mismatch, or copy-on-write (see CanInheritOnDuplicate)
 					T* TypedOut = SharedContext.Get()->ManagedObjects->New<T>();
 					Out = Cast<UPCGBasePointData>(TypedOut);
 
 					FPCGInitializeFromDataParams InitializeFromDataParams(In);
 					Out->InitializeFromDataWithParams(InitializeFromDataParams);
 					PCGExHelpers::CopyBaseNativeProperties(In, Out);
+
+					bInheritedOutput = true;
 				}
 
 				return true;
@@ -255,6 +274,7 @@ namespace PCGExData
 
 		void CopyToNewPoint(const int32 InIndex, int32& OutIndex) const
 		{
+			MaterializeOutput();
 			FWriteScopeLock WriteLock(PointsLock);
 			OutIndex = Out->GetNumPoints();
 			Out->SetNumPoints(OutIndex + 1);
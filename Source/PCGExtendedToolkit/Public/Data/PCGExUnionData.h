@@ -52,12 +52,20 @@ namespace PCGExData
 	};
 
 
+	// Turns raw squared distances stored in Weight into normalized weights; shared by the per-entry and flat paths
+	PCGEXTENDEDTOOLKIT_API int32 FinalizeUnionWeights(TArray<FWeightedPoint>& InOutWeightedPoints, const double MaxWeight);
+
 	class PCGEXTENDEDTOOLKIT_API FUnionMetadata : public TSharedFromThis<FUnionMetadata>
 	{
 	public:
 		TArray<TSharedPtr<IUnionData>> Entries;
 		bool bIsAbstract = false;
 
+		// Flat (CSR) copy of all entries' elements, built by Flatten() once insertion is complete.
+		// Elements of entry i are FlatElements[FlatOffsets[i] .. FlatOffsets[i + 1]).
+		TArray<int32> FlatOffsets;
+		TArray<FElement> FlatElements;
+
 		FUnionMetadata() = default;
 		~FUnionMetadata() = default;
 
@@ -71,6 +79,11 @@ namespace PCGExData
 		bool IOIndexOverlap(const int32 InIdx, const TSet<int32>& InIndices);
 
 		FORCEINLINE TSharedPtr<IUnionData> Get(const int32 Index) const { return Entries.IsValidIndex(Index) ? Entries[Index] : nullptr; }
+
+		// Must only be called once no more elements will be added; entries created afterward invalidate the flat view
+		void Flatten();
+		FORCEINLINE bool IsFlat() const { return FlatOffsets.Num() == Entries.Num() + 1; }
+		FORCEINLINE TConstArrayView<FElement> GetFlatElements(const int32 Index) const { return TConstArrayView<FElement>(FlatElements.GetData() + FlatOffsets[Index], FlatOffsets[Index + 1] - FlatOffsets[Index]); }
 	};
 
 #pragma endregion
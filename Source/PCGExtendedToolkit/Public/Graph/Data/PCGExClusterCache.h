@@ -0,0 +1,57 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Graph/PCGExEdge.h"
+
+/**
+ * Binary sidecar holding the compiled topology of a cluster, so it can be loaded instead of rebuilt.
+ * The blob is derived from the edge endpoints alone; vtx ids are resolved against the current vtx lookup at load time.
+ *
+ * Layout (native endianness, every section 4-bytes aligned) :
+ * FHeader | uint32 NodeVtxIds[NumNodes] | int32 LinkOffsets[NumNodes + 1] | FLink Links[NumLinks] | int32 EdgeNodes[NumEdges * 2]
+ */
+namespace PCGExClusterCache
+{
+	constexpr uint32 Magic = 0x43584350; // PCXC
+	constexpr uint32 Version = 1;
+
+	struct FHeader
+	{
+		uint32 Magic = 0;
+		uint32 Version = 0;
+		uint64 ContentHash = 0; // Of the edge endpoints the blob was compiled from
+		int32 NumEdges = 0;
+		int32 NumNodes = 0;
+		int32 NumLinks = 0;
+		uint32 PayloadCrc = 0;
+	};
+
+	/** Validated, zero-copy view into a blob */
+	struct FView
+	{
+		TConstArrayView<uint32> NodeVtxIds;
+		TConstArrayView<int32> LinkOffsets; // Links of node N are in [LinkOffsets[N], LinkOffsets[N + 1])
+		TConstArrayView<PCGExGraph::FLink> Links;
+		TConstArrayView<int32> EdgeNodes; // Start & end node of each edge, interleaved
+
+		FORCEINLINE int32 NumNodes() const { return NodeVtxIds.Num(); }
+		FORCEINLINE int32 NumEdges() const { return EdgeNodes.Num() / 2; }
+	};
+
+	PCGEXTENDEDTOOLKIT_API
+	uint64 ComputeContentHash(TConstArrayView<int64> InEdgeEndpoints);
+
+	/**
+	 * Compile edge endpoints into a blob, with the same node & link order FCluster::BuildFrom would produce.
+	 * @return false if the edges can't form a valid cluster, OutBlob is left empty.
+	 */
+	PCGEXTENDEDTOOLKIT_API
+	bool Write(TConstArrayView<int64> InEdgeEndpoints, TArray<uint8>& OutBlob);
+
+	/** @return false if the blob is malformed, from another version, corrupted or compiled from different edges */
+	PCGEXTENDEDTOOLKIT_API
+	bool Read(TConstArrayView<uint8> InBlob, TConstArrayView<int64> InEdgeEndpoints, FView& OutView);
+}
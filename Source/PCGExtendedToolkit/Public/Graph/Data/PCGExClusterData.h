@@ -56,11 +56,18 @@ public:
 	virtual void SetBoundCluster(const TSharedPtr<PCGExCluster::FCluster>& InCluster);
 	const TSharedPtr<PCGExCluster::FCluster>& GetBoundCluster() const;
 
+	/** Compiled topology sidecar, see PCGExClusterCache. Empty unless the data was saved with bPersistClusterCache. */
+	FORCEINLINE const TArray<uint8>& GetClusterCache() const { return ClusterCache; }
+
+	virtual void PreSave(FObjectPreSaveContext SaveContext) override;
 	virtual void BeginDestroy() override;
 
 protected:
 	TSharedPtr<PCGExCluster::FCluster> Cluster;
 
+	UPROPERTY()
+	TArray<uint8> ClusterCache;
+
 	virtual UPCGSpatialData* CopyInternal(FPCGContext* Context) const override;
 };
 
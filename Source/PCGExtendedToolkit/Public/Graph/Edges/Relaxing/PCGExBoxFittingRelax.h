@@ -58,34 +58,69 @@ public:
 		const FBox CurrentBox = BoxBuffer[Node.Index];
 		const FVector& CurrentPos = CurrentTr.GetLocation();
 
-		// Apply repulsion forces between all pairs of nodes
-		const int32 NumNodes = Cluster->Nodes->Num();
-		for (int32 OtherNodeIndex = Node.Index + 1; OtherNodeIndex < NumNodes; OtherNodeIndex++)
+		if (Repulsion == EPCGExRelaxRepulsion::AllPairs)
 		{
-			const FTransform& OtherTr = *(ReadBuffer->GetData() + OtherNodeIndex);
-			const PCGExCluster::FNode* OtherNode = Cluster->GetNode(OtherNodeIndex);
-			const FVector& OtherPos = (ReadBuffer->GetData() + OtherNodeIndex)->GetLocation();
+			// Apply repulsion forces between all pairs of nodes
+			const int32 NumNodes = Cluster->Nodes->Num();
+			for (int32 OtherNodeIndex = Node.Index + 1; OtherNodeIndex < NumNodes; OtherNodeIndex++)
+			{
+				const PCGExCluster::FNode* OtherNode = Cluster->GetNode(OtherNodeIndex);
+				const FVector& OtherPos = (ReadBuffer->GetData() + OtherNodeIndex)->GetLocation();
 
-			// Transform boxes to world space
-			const FBox OtherBox = BoxBuffer[OtherNodeIndex];
+				FVector Force;
+				if (!ComputeRepulsion(CurrentBox, CurrentPos, BoxBuffer[OtherNodeIndex], OtherPos, Force)) { continue; }
 
-			// Check for overlap
-			if (!CurrentBox.Intersect(OtherBox)) { continue; }
+				AddDelta(OtherNode->Index, Node.Index, Force);
+			}
 
-			// Calculate overlap resolution force
-			// TODO : Test with repulsion based on overlap size
-			FVector Delta = OtherPos - CurrentPos;
-			const double Distance = Delta.Size();
+			return;
+		}
 
-			if (Distance <= KINDA_SMALL_NUMBER) { continue; }
+		// Gather repulsion from neighbors only; each node accumulates its own share so a single delta is written
 
-			// Overlap resolution
-			FVector OverlapSize = CurrentBox.GetExtent() + OtherBox.GetExtent() - PCGExMath::Abs(Delta);
+		FVector Sum = FVector::ZeroVector;
 
-			AddDelta(OtherNode->Index, Node.Index, (RepulsionConstant * OverlapSize * (Delta / Distance)));
-		}
+		ForEachRepulsor(
+			Node.Index,
+			[&](const int32 OtherNodeIndex)
+			{
+				FVector Force;
+				if (ComputeRepulsion(CurrentBox, CurrentPos, BoxBuffer[OtherNodeIndex], (ReadBuffer->GetData() + OtherNodeIndex)->GetLocation(), Force)) { Sum -= Force; }
+			},
+			[&](const FVector& Center, const FVector& MeanExtent, const int32 Count)
+			{
+				FVector Force;
+				if (ComputeRepulsion(CurrentBox, CurrentPos, FBox(Center - MeanExtent, Center + MeanExtent), Center, Force)) { Sum -= Force * Count; }
+			});
+
+		AddDelta(Node.Index, Sum);
 	}
 
 protected:
 	TArray<FBox> BoxBuffer;
+
+	virtual void GetRepulsionBounds(const int32 NodeIndex, FVector& OutCenter, FVector& OutExtent) const override
+	{
+		BoxBuffer[NodeIndex].GetCenterAndExtents(OutCenter, OutExtent);
+	}
+
+	/** Force applied to Other, the opposite being applied to the current node */
+	FORCEINLINE bool ComputeRepulsion(const FBox& CurrentBox, const FVector& CurrentPos, const FBox& OtherBox, const FVector& OtherPos, FVector& OutForce) const
+	{
+		// Check for overlap
+		if (!CurrentBox.Intersect(OtherBox)) { return false; }
+
+		// Calculate overlap resolution force
+		// TODO : Test with repulsion based on overlap size
+		const FVector Delta = OtherPos - CurrentPos;
+		const double Distance = Delta.Size();
+
+		if (Distance <= KINDA_SMALL_NUMBER) { return false; }
+
+		// Overlap resolution
+		const FVector OverlapSize = CurrentBox.GetExtent() + OtherBox.GetExtent() - PCGExMath::Abs(Delta);
+
+		OutForce = RepulsionConstant * OverlapSize * (Delta / Distance);
+		return true;
+	}
 };
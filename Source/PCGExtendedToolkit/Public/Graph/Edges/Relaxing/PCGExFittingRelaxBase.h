@@ -5,6 +5,7 @@
 
 #include "CoreMinimal.h"
 #include "PCGExRelaxClusterOperation.h"
+#include "PCGExFittingRelaxRepulsion.h"
 #include "Data/PCGExData.h"
 
 
@@ -19,6 +20,14 @@ enum class EPCGExRelaxEdgeFitting : uint8
 	Attribute = 3 UMETA(DisplayName = "Attribute", ToolTip="Uses an attribute on the edges as target length"),
 };
 
+UENUM()
+enum class EPCGExRelaxRepulsion : uint8
+{
+	AllPairs    = 0 UMETA(DisplayName = "All Pairs", ToolTip="Test every node against every other node. Exact, but quadratic."),
+	SpatialHash = 1 UMETA(DisplayName = "Spatial Hash", ToolTip="Only test nodes in neighboring cells of a grid sized after the largest node. Exact."),
+	BarnesHut   = 2 UMETA(DisplayName = "Barnes-Hut", ToolTip="Hierarchical approximation; distant groups of nodes are treated as a single averaged node."),
+};
+
 /**
  * 
  */
@@ -62,6 +71,14 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
 	double TimeStep = 0.01;
 
+	/** How repulsion candidates are found. Acceleration structures are rebuilt once per iteration. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
+	EPCGExRelaxRepulsion Repulsion = EPCGExRelaxRepulsion::AllPairs;
+
+	/** Barnes-Hut opening criterion. A group of nodes is approximated when its size / distance is below this value. 0 is exact. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, DisplayName=" └─ Theta", EditCondition="Repulsion == EPCGExRelaxRepulsion::BarnesHut", EditConditionHides, ClampMin=0))
+	double Theta = 0.5;
+
 	virtual bool PrepareForCluster(FPCGExContext* InContext, const TSharedPtr<PCGExCluster::FCluster>& InCluster) override
 	{
 		if (!Super::PrepareForCluster(InContext, InCluster)) { return false; }
@@ -113,6 +130,8 @@ public:
 		}
 
 		// Step 2 : Apply repulsion forces between all pairs of nodes
+		if (InStep == 1 && Repulsion != EPCGExRelaxRepulsion::AllPairs) { BuildRepulsion(); }
+
 		// Step 3 : Update positions based on accumulated forces
 		return EPCGExClusterElement::Vtx;
 	}
@@ -151,6 +170,46 @@ public:
 protected:
 	TSharedPtr<TArray<double>> EdgeLengths;
 
+	TArray<FVector> RepulsionCenters;
+	TArray<FVector> RepulsionExtents;
+	PCGExFittingRelax::FRepulsionGrid RepulsionGrid;
+	PCGExFittingRelax::FRepulsionTree RepulsionTree;
+
+	/** Repulsion bounds of a node, as center & extents. Read once per iteration when using an acceleration structure. */
+	virtual void GetRepulsionBounds(const int32 NodeIndex, FVector& OutCenter, FVector& OutExtent) const
+	{
+		OutCenter = (ReadBuffer->GetData() + NodeIndex)->GetLocation();
+		OutExtent = FVector::ZeroVector;
+	}
+
+	void BuildRepulsion()
+	{
+		const int32 NumNodes = Cluster->Nodes->Num();
+		RepulsionCenters.SetNumUninitialized(NumNodes);
+		RepulsionExtents.SetNumUninitialized(NumNodes);
+
+		double MaxReach = 0;
+		for (int i = 0; i < NumNodes; i++)
+		{
+			GetRepulsionBounds(i, RepulsionCenters[i], RepulsionExtents[i]);
+			MaxReach = FMath::Max(MaxReach, RepulsionExtents[i].GetMax());
+		}
+
+		if (Repulsion == EPCGExRelaxRepulsion::SpatialHash) { RepulsionGrid.Build(RepulsionCenters, MaxReach * 2); }
+		else { RepulsionTree.Build(RepulsionCenters, RepulsionExtents); }
+	}
+
+	/**
+	 * Visit repulsion candidates of a node using the selected acceleration structure.
+	 * OnAggregate(Center, MeanExtent, Count) is only called in Barnes-Hut mode.
+	 */
+	template <typename ItemFuncType, typename AggregateFuncType>
+	void ForEachRepulsor(const int32 NodeIndex, ItemFuncType&& OnItem, AggregateFuncType&& OnAggregate) const
+	{
+		if (Repulsion == EPCGExRelaxRepulsion::SpatialHash) { RepulsionGrid.ForEachCandidate(NodeIndex, OnItem); }
+		else { RepulsionTree.ForEachRepulsor(NodeIndex, Theta, OnItem, OnAggregate); }
+	}
+
 	FVector GetDelta(const int32 Index) const
 	{
 		const FIntVector3& P = Deltas[Index];
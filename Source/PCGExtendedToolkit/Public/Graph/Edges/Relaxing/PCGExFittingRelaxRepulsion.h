@@ -0,0 +1,139 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExFittingRelax
+{
+	/**
+	 * Uniform spatial hash over repulsion centers.
+	 * With a cell size of twice the largest reach, any two overlapping items are at most one cell apart.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FRepulsionGrid
+	{
+		double InvCellSize = 1;
+
+		TMap<FIntVector, int32> CellIndices;
+		TArray<int32> CellStarts; // NumCells + 1 offsets into Items
+		TArray<int32> Items;
+		TArray<FIntVector> ItemCells;
+
+	public:
+		FRepulsionGrid() = default;
+
+		void Build(const TArray<FVector>& InCenters, const double InCellSize);
+
+		/** Calls Func(OtherIndex) for every item sharing or neighboring the cell of InIndex */
+		template <typename FuncType>
+		void ForEachCandidate(const int32 InIndex, FuncType&& Func) const
+		{
+			const FIntVector& Cell = ItemCells[InIndex];
+
+			for (int32 X = -1; X <= 1; X++)
+			{
+				for (int32 Y = -1; Y <= 1; Y++)
+				{
+					for (int32 Z = -1; Z <= 1; Z++)
+					{
+						const int32* CellIndex = CellIndices.Find(Cell + FIntVector(X, Y, Z));
+						if (!CellIndex) { continue; }
+
+						for (int32 i = CellStarts[*CellIndex]; i < CellStarts[*CellIndex + 1]; i++)
+						{
+							if (Items[i] != InIndex) { Func(Items[i]); }
+						}
+					}
+				}
+			}
+		}
+	};
+
+	/**
+	 * Barnes-Hut tree over repulsion centers.
+	 * Branches that cannot overlap the query are pruned; distant branches that are small enough relative to
+	 * their distance (size / distance < theta) are approximated as a single aggregate at their center of mass.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FRepulsionTree
+	{
+	public:
+		struct FNode
+		{
+			FBox Bounds = FBox(ForceInit); // Bounds of the centers
+			FVector Center = FVector::ZeroVector;
+			FVector MeanExtent = FVector::ZeroVector;
+			double MaxReach = 0;
+			int32 Start = 0;
+			int32 End = 0;
+			int32 Left = -1;
+			int32 Right = -1;
+
+			FORCEINLINE bool IsLeaf() const { return Left == -1; }
+		};
+
+		static constexpr int32 MaxItemsPerLeaf = 8;
+
+	protected:
+		TArray<FNode> Nodes;
+		TArray<int32> Items;
+
+		const TArray<FVector>* Centers = nullptr;
+		const TArray<FVector>* Extents = nullptr;
+
+	public:
+		FRepulsionTree() = default;
+
+		void Build(const TArray<FVector>& InCenters, const TArray<FVector>& InExtents);
+
+		/**
+		 * Calls OnItem(OtherIndex) for items that must be resolved exactly,
+		 * and OnAggregate(Center, MeanExtent, Count) for approximated branches.
+		 */
+		template <typename ItemFuncType, typename AggregateFuncType>
+		void ForEachRepulsor(const int32 InIndex, const double InTheta, ItemFuncType&& OnItem, AggregateFuncType&& OnAggregate) const
+		{
+			if (Nodes.IsEmpty()) { return; }
+
+			const FVector& Center = (*Centers)[InIndex];
+			const double Reach = (*Extents)[InIndex].GetMax();
+			const double ThetaSquared = InTheta * InTheta;
+
+			int32 Stack[64];
+			int32 StackSize = 0;
+			Stack[StackSize++] = 0;
+
+			while (StackSize)
+			{
+				const FNode& Node = Nodes[Stack[--StackSize]];
+
+				// Nothing in there can reach us
+				if (!Node.Bounds.ExpandBy(Reach + Node.MaxReach).IsInsideOrOn(Center)) { continue; }
+
+				if (Node.IsLeaf())
+				{
+					for (int32 i = Node.Start; i < Node.End; i++)
+					{
+						if (Items[i] != InIndex) { OnItem(Items[i]); }
+					}
+
+					continue;
+				}
+
+				// Never approximate a branch that may contain the query itself
+				if (!Node.Bounds.IsInsideOrOn(Center) &&
+					FMath::Square(Node.Bounds.GetSize().GetMax()) < ThetaSquared * FVector::DistSquared(Center, Node.Center))
+				{
+					OnAggregate(Node.Center, Node.MeanExtent, Node.End - Node.Start);
+					continue;
+				}
+
+				Stack[StackSize++] = Node.Left;
+				Stack[StackSize++] = Node.Right;
+			}
+		}
+
+	protected:
+		int32 BuildRecursive(const int32 Start, const int32 End);
+	};
+}
@@ -31,7 +31,7 @@ public:
 		const FVector Position = (ReadBuffer->GetData() + Node.Index)->GetLocation();
 		FVector Force = FVector::ZeroVector;
 
-		for (const PCGExGraph::FLink& Lk : Node.Links)
+		for (const PCGExGraph::FLink& Lk : Cluster->GetLinks(Node.Index))
 		{
 			const FVector OtherPosition = (ReadBuffer->GetData() + Lk.Node)->GetLocation();
 			CalculateAttractiveForce(Force, Position, OtherPosition);
@@ -21,8 +21,9 @@ public:
 		const FVector Position = (ReadBuffer->GetData() + Node.Index)->GetLocation();
 		FVector Force = FVector::ZeroVector;
 
-		for (const PCGExGraph::FLink& Lk : Node.Links) { Force += (ReadBuffer->GetData() + Lk.Node)->GetLocation() - Position; }
+		const TConstArrayView<PCGExGraph::FLink> Links = Cluster->GetLinks(Node.Index);
+		for (const PCGExGraph::FLink& Lk : Links) { Force += (ReadBuffer->GetData() + Lk.Node)->GetLocation() - Position; }
 
-		(*WriteBuffer)[Node.Index].SetLocation(Position + Force / static_cast<double>(Node.Links.Num()));
+		(*WriteBuffer)[Node.Index].SetLocation(Position + Force / static_cast<double>(Links.Num()));
 	}
 };
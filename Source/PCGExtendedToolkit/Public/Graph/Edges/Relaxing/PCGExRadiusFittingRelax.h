@@ -62,25 +62,63 @@ public:
 		const FVector& CurrentPos = (ReadBuffer->GetData() + Node.Index)->GetLocation();
 		const double& CurrentRadius = RadiusBuffer->Read(Node.PointIndex);
 
-		// Apply repulsion forces between all pairs of nodes
-
-		for (int32 OtherNodeIndex = Node.Index + 1; OtherNodeIndex < Cluster->Nodes->Num(); OtherNodeIndex++)
+		if (Repulsion == EPCGExRelaxRepulsion::AllPairs)
 		{
-			const PCGExCluster::FNode* OtherNode = Cluster->GetNode(OtherNodeIndex);
-			const FVector& OtherPos = (ReadBuffer->GetData() + OtherNodeIndex)->GetLocation();
+			// Apply repulsion forces between all pairs of nodes
+
+			for (int32 OtherNodeIndex = Node.Index + 1; OtherNodeIndex < Cluster->Nodes->Num(); OtherNodeIndex++)
+			{
+				const PCGExCluster::FNode* OtherNode = Cluster->GetNode(OtherNodeIndex);
+				const FVector& OtherPos = (ReadBuffer->GetData() + OtherNodeIndex)->GetLocation();
 
-			FVector Delta = OtherPos - CurrentPos;
-			const double Distance = Delta.Size();
-			const double Overlap = (CurrentRadius + RadiusBuffer->Read(OtherNode->PointIndex)) - Distance;
+				FVector Force;
+				if (!ComputeRepulsion(CurrentPos, CurrentRadius, OtherPos, RadiusBuffer->Read(OtherNode->PointIndex), Force)) { continue; }
 
-			if (Overlap <= 0 || Distance <= KINDA_SMALL_NUMBER) { continue; }
+				AddDelta(OtherNode->Index, Node.Index, Force);
+			}
 
-			AddDelta(
-				OtherNode->Index, Node.Index,
-				(RepulsionConstant * (Overlap / FMath::Square(Distance)) * (Delta / Distance)));
+			return;
 		}
+
+		// Gather repulsion from neighbors only; each node accumulates its own share so a single delta is written
+
+		FVector Sum = FVector::ZeroVector;
+
+		ForEachRepulsor(
+			Node.Index,
+			[&](const int32 OtherNodeIndex)
+			{
+				FVector Force;
+				if (ComputeRepulsion(CurrentPos, CurrentRadius, RepulsionCenters[OtherNodeIndex], RepulsionExtents[OtherNodeIndex].X, Force)) { Sum -= Force; }
+			},
+			[&](const FVector& Center, const FVector& MeanExtent, const int32 Count)
+			{
+				FVector Force;
+				if (ComputeRepulsion(CurrentPos, CurrentRadius, Center, MeanExtent.X, Force)) { Sum -= Force * Count; }
+			});
+
+		AddDelta(Node.Index, Sum);
 	}
 
 protected:
 	TSharedPtr<PCGExDetails::TSettingValue<double>> RadiusBuffer;
+
+	virtual void GetRepulsionBounds(const int32 NodeIndex, FVector& OutCenter, FVector& OutExtent) const override
+	{
+		OutCenter = (ReadBuffer->GetData() + NodeIndex)->GetLocation();
+		OutExtent = FVector(RadiusBuffer->Read(Cluster->GetNodePointIndex(NodeIndex)));
+	}
+
+	/** Force applied to Other, the opposite being applied to the current node */
+	FORCEINLINE bool ComputeRepulsion(const FVector& CurrentPos, const double CurrentRadius, const FVector& OtherPos, const double OtherRadius, FVector& OutForce) const
+	{
+		const FVector Delta = OtherPos - CurrentPos;
+		const double Distance = Delta.Size();
+		const double Overlap = (CurrentRadius + OtherRadius) - Distance;
+
+		if (Overlap <= 0 || Distance <= KINDA_SMALL_NUMBER) { return false; }
+
+		OutForce = RepulsionConstant * (Overlap / FMath::Square(Distance)) * (Delta / Distance);
+		return true;
+	}
 };
@@ -109,8 +109,10 @@ namespace PCGExFloodFill
 	class FDiffusion : public TSharedFromThis<FDiffusion>
 	{
 	protected:
-		TSet<int32> Visited;
-		// use map hash lookup to reduce memory overhead of a shared map + thread safety yay
+		// Nodes that have been seen as candidates at least once, sized to the cluster
+		TBitArray<> Visited;
+		// Node index -> slot in the Candidates heap, for nodes currently in the frontier. Kept sparse, there's one per seed
+		TMap<int32, int32> HeapIndices;
 
 		int32 MaxDepth = 0;
 		double MaxDistance = 0;
@@ -122,12 +124,12 @@ namespace PCGExFloodFill
 		bool bStopped = false;
 		const PCGExCluster::FNode* SeedNode = nullptr;
 		int32 SeedIndex = -1;
-		TSet<int32> Endpoints;
+		TBitArray<> Endpoints; // Indexed by CaptureIndex
 
 		TSharedPtr<PCGEx::FHashLookupMap> TravelStack; // Required for FillControls & Heuristics
 		TSharedPtr<PCGExCluster::FCluster> Cluster;
 
-		TArray<FCandidate> Candidates;
+		TArray<FCandidate> Candidates; // 4-ary min-heap, ordered by the active prioritization
 		TArray<FCandidate> Captured;
 
 		FDiffusion(const TSharedPtr<FFillControlsHandler>& InFillControlsHandler, const TSharedPtr<PCGExCluster::FCluster>& InCluster, const PCGExCluster::FNode* InSeedNode);
@@ -140,10 +142,34 @@ namespace PCGExFloodFill
 		void Grow();
 		void PostGrow();
 
+		// Free frontier data once the diffusion is complete; Captured, Endpoints & TravelStack are kept around for paths
+		FORCEINLINE void ReleaseFrontier()
+		{
+			Candidates.Empty();
+			HeapIndices.Empty();
+			Visited.Empty();
+		}
+
+		FORCEINLINE int32 GetNumEndpoints() const { return Endpoints.CountSetBits(); }
+		FORCEINLINE bool IsEndpoint(const int32 CaptureIndex) const { return Endpoints.IsValidIndex(CaptureIndex) && Endpoints[CaptureIndex]; }
+
 		void Diffuse(
 			const TSharedPtr<PCGExData::FFacade>& InVtxFacade,
 			const TSharedPtr<PCGExDataBlending::FBlendOpsManager>& InBlendOps,
 			TArray<int32>& OutIndices);
+
+	protected:
+		bool IsBetterCandidate(const FCandidate& A, const FCandidate& B) const;
+		void PushCandidate(const FCandidate& Candidate);
+		void UpdateCandidate(const int32 HeapIndex, const FCandidate& Candidate);
+		FCandidate PopCandidate();
+		void SiftUp(int32 HeapIndex);
+		void SiftDown(int32 HeapIndex);
+		FORCEINLINE void PlaceCandidate(const int32 HeapIndex, const FCandidate& Candidate)
+		{
+			Candidates[HeapIndex] = Candidate;
+			HeapIndices.Add(Candidate.Node->Index, HeapIndex);
+		}
 	};
 
 	class PCGEXTENDEDTOOLKIT_API FFillControlsHandler : public TSharedFromThis<FFillControlsHandler>
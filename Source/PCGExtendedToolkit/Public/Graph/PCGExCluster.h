@@ -117,6 +117,48 @@ namespace PCGExCluster
 		bool operator==(const FBoundedEdge& ExpandedEdge) const { return (Index == ExpandedEdge.Index && Bounds == ExpandedEdge.Bounds); };
 	};
 
+	/**
+	 * Compressed-sparse-row copy of the cluster adjacency.
+	 * Links of node N are packed in Links[Offsets[N] .. Offsets[N + 1]).
+	 */
+	struct PCGEXTENDEDTOOLKIT_API FFlatAdjacency
+	{
+		TArray<int32> Offsets;
+		TArray<FLink> Links;
+
+		FFlatAdjacency() = default;
+		explicit FFlatAdjacency(const TArray<FNode>& InNodes);
+
+		FORCEINLINE int32 NumNodes() const { return Offsets.Num() - 1; }
+		FORCEINLINE int32 Num(const int32 NodeIndex) const { return Offsets[NodeIndex + 1] - Offsets[NodeIndex]; }
+		FORCEINLINE TConstArrayView<FLink> Get(const int32 NodeIndex) const
+		{
+			const int32 Start = Offsets[NodeIndex];
+			return TConstArrayView<FLink>(Links.GetData() + Start, Offsets[NodeIndex + 1] - Start);
+		}
+	};
+
+	class FCluster;
+
+	/**
+	 * ALT landmarks: exact shortest-path distances, over the cluster' edge lengths, from a few well-spread nodes.
+	 * For any landmark L, |d(L, A) - d(L, B)| is a lower bound of d(A, B) (triangle inequality).
+	 */
+	struct PCGEXTENDEDTOOLKIT_API FLandmarks
+	{
+		int32 NumNodes = 0;
+		int32 NumRequested = 0;   // May be more than Num(), selection stops early on coincident nodes
+		TArray<int32> Nodes;      // Landmark node indices
+		TArray<double> Distances; // Landmark-major, Distances[Landmark * NumNodes + Node]
+
+		FLandmarks() = default;
+
+		void Build(const FCluster& InCluster, const int32 NumLandmarks);
+
+		FORCEINLINE int32 Num() const { return Nodes.Num(); }
+		double GetLowerBound(const int32 From, const int32 To) const;
+	};
+
 	class PCGEXTENDEDTOOLKIT_API FCluster : public TSharedFromThis<FCluster>
 	{
 	protected:
@@ -141,6 +183,8 @@ namespace PCGExCluster
 		TSharedPtr<TArray<FBoundedEdge>> BoundedEdges;
 		TSharedPtr<TArray<FEdge>> Edges;
 		TSharedPtr<TArray<double>> EdgeLengths;
+		TSharedPtr<FFlatAdjacency> FlatAdjacency; // Optional, only built when enabled in global settings
+		mutable TSharedPtr<FLandmarks> Landmarks; // Optional, built on demand by landmark heuristics
 		TConstPCGValueRange<FTransform> VtxTransforms;
 
 		FBox Bounds = FBox(NoInit);
@@ -207,6 +251,16 @@ namespace PCGExCluster
 
 		void BuildFrom(const TSharedRef<PCGExGraph::FSubGraph>& SubGraph);
 
+		/**
+		 * Load topology from the edges' persisted cluster cache, if any.
+		 * Leaves the cluster untouched and returns false if there is no cache or it doesn't match the current vtx/edges.
+		 */
+		bool BuildFromCache(
+			const TMap<uint32, int32>& InEndpointsLookup,
+			const TArray<int32>* InExpectedAdjacency);
+
+		void BuildFlatAdjacency();
+
 		bool IsValidWith(const TSharedRef<PCGExData::FPointIO>& InVtxIO, const TSharedRef<PCGExData::FPointIO>& InEdgesIO) const;
 		bool HasTag(const FString& InTag);
 
@@ -217,6 +271,14 @@ namespace PCGExCluster
 		FORCEINLINE FEdge* GetEdge(const int32 Index) const { return (Edges->GetData() + Index); }
 		FORCEINLINE FEdge* GetEdge(const FLink Lk) const { return (Edges->GetData() + Lk.Edge); }
 
+		FORCEINLINE TConstArrayView<FLink> GetLinks(const int32 NodeIndex) const
+		{
+			if (FlatAdjacency) { return FlatAdjacency->Get(NodeIndex); }
+			return TConstArrayView<FLink>((Nodes->GetData() + NodeIndex)->Links);
+		}
+
+		FORCEINLINE TConstArrayView<FLink> GetLinks(const FNode& InNode) const { return GetLinks(InNode.Index); }
+
 		FORCEINLINE FNode* GetEdgeStart(const FEdge* InEdge) const { return (Nodes->GetData() + NodeIndexLookup->Get(InEdge->Start)); }
 		FORCEINLINE FNode* GetEdgeStart(const FEdge& InEdge) const { return (Nodes->GetData() + NodeIndexLookup->Get(InEdge.Start)); }
 		FORCEINLINE FNode* GetEdgeStart(const int32 InEdgeIndex) const { return (Nodes->GetData() + NodeIndexLookup->Get((Edges->GetData() + InEdgeIndex)->Start)); }
@@ -452,6 +514,9 @@ namespace PCGExCluster
 
 		void ComputeEdgeLengths(bool bNormalize = false);
 
+		/** Cached landmark distances, built over EdgeLengths the first time they're requested. Requires edge lengths. */
+		TSharedPtr<FLandmarks> GetLandmarks(const int32 NumLandmarks) const;
+
 		void GetConnectedNodes(const int32 FromIndex, TArray<int32>& OutIndices, const int32 SearchDepth) const;
 		void GetConnectedNodes(const int32 FromIndex, TArray<int32>& OutIndices, const int32 SearchDepth, const TSet<int32>& Skip) const;
 
@@ -477,10 +542,11 @@ namespace PCGExCluster
 		void GrabNeighbors(const int32 NodeIndex, TArray<T>& OutNeighbors, const MakeFunc&& Make) const
 		{
 			FNode* Node = (Nodes->GetData() + NodeIndex);
-			PCGEx::InitArray(OutNeighbors, Node->Num());
-			for (int i = 0; i < Node->Num(); i++)
+			const TConstArrayView<FLink> Links = GetLinks(NodeIndex);
+			PCGEx::InitArray(OutNeighbors, Links.Num());
+			for (int i = 0; i < Links.Num(); i++)
 			{
-				const FLink Lk = Node->Links[i];
+				const FLink Lk = Links[i];
 				OutNeighbors[i] = Make(Node, (Nodes->GetData() + Lk.Node), (Edges->GetData() + Lk.Edge));
 			}
 		}
@@ -488,10 +554,11 @@ namespace PCGExCluster
 		template <typename T, class MakeFunc>
 		void GrabNeighbors(const FNode& Node, TArray<T>& OutNeighbors, const MakeFunc&& Make) const
 		{
-			PCGEx::InitArray(OutNeighbors, Node.Num());
-			for (int i = 0; i < Node.Num(); i++)
+			const TConstArrayView<FLink> Links = GetLinks(Node.Index);
+			PCGEx::InitArray(OutNeighbors, Links.Num());
+			for (int i = 0; i < Links.Num(); i++)
 			{
-				const FLink Lk = Node.Links[i];
+				const FLink Lk = Links[i];
 				OutNeighbors[i] = Make((Nodes->GetData() + Lk.Node), (Edges->GetData() + Lk.Edge));
 			}
 		}
@@ -100,6 +100,7 @@ namespace PCGExConnectPoints
 		TArray<TSharedPtr<FPCGExProbeOperation>> SharedProbeOperations;
 
 		bool bUseVariableRadius = false;
+		bool bCanBoundCandidates = false;
 		int32 NumChainedOps = 0;
 		double SharedSearchRadius = 0;
 
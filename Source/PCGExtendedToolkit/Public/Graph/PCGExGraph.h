@@ -349,8 +349,8 @@ namespace PCGExGraph
 	{
 	public:
 		TWeakPtr<FGraph> WeakParentGraph;
-		TSet<int32> Nodes;
-		TSet<int32> Edges;
+		TArray<int32> Nodes; // Unique, sorted graph node indices
+		TArray<int32> Edges; // Unique, sorted graph edge indices
 		TSet<int32> EdgesInIOIndices;
 		TSharedPtr<PCGExData::FFacade> VtxDataFacade;
 		TSharedPtr<PCGExData::FFacade> EdgesDataFacade;
@@ -363,8 +363,6 @@ namespace PCGExGraph
 
 		~FSubGraph() = default;
 
-		void Add(const FEdge& Edge, FGraph* InGraph);
-
 		void Invalidate(FGraph* InGraph);
 		void BuildCluster(const TSharedRef<PCGExCluster::FCluster>& InCluster);
 		int32 GetFirstInIOIndex();
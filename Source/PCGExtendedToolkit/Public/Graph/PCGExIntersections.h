@@ -145,17 +145,20 @@ namespace PCGExGraph
 {
 #pragma region Compound Graph
 
-	class PCGEXTENDEDTOOLKIT_API FUnionNode : public TSharedFromThis<FUnionNode>
+	class PCGEXTENDEDTOOLKIT_API FUnionNode
 	{
 	protected:
 		mutable FRWLock AdjacencyLock;
 
 	public:
-		const PCGExData::FConstPoint Point;
+		PCGExData::FConstPoint Point;
 		FVector Center;
 		FBoxSphereBounds Bounds;
 		int32 Index;
 
+		// Union data for this node; moved into FUnionGraph::NodesUnion once the graph is collapsed
+		TSharedPtr<PCGExData::IUnionData> Union;
+
 		TSet<int32, DefaultKeyFuncs<int32>, InlineSparseAllocator> Adjacency;
 
 		FUnionNode(const PCGExData::FConstPoint& InPoint, const FVector& InCenter, const int32 InIndex);
@@ -164,18 +167,69 @@ namespace PCGExGraph
 		FVector UpdateCenter(const TSharedPtr<PCGExData::FUnionMetadata>& InUnionMetadata, const TSharedPtr<PCGExData::FPointIOCollection>& IOGroup);
 
 		void Add(const int32 InAdjacency);
+
+		// Swap the representative point for the given one if it comes first in (IO, Index) order
+		bool Rebase(const PCGExData::FConstPoint& InPoint, const FVector& InCenter);
 	};
 
 	PCGEX_OCTREE_SEMANTICS(FUnionNode, { return Element->Bounds;}, { return A->Index == B->Index; })
 
+	/**
+	 * Chunked, append-only storage for union nodes.
+	 * Node addresses are stable for the lifetime of the pool. Not thread-safe; callers must serialize Emplace.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FUnionNodePool
+	{
+	public:
+		static constexpr int32 ChunkSize = 256;
+
+	protected:
+		TArray<FUnionNode*> Chunks;
+		int32 NumNodes = 0;
+
+	public:
+		FUnionNodePool() = default;
+		~FUnionNodePool();
+
+		FUnionNodePool(const FUnionNodePool&) = delete;
+		FUnionNodePool& operator=(const FUnionNodePool&) = delete;
+
+		FORCEINLINE int32 Num() const { return NumNodes; }
+
+		FUnionNode* Emplace(const PCGExData::FConstPoint& InPoint, const FVector& InCenter, const int32 InIndex);
+
+		template <typename FunctionType>
+		void ForEach(FunctionType&& Func) const
+		{
+			for (int32 i = 0; i < NumNodes; i++) { Func(Chunks[i / ChunkSize] + (i % ChunkSize)); }
+		}
+	};
+
 	class PCGEXTENDEDTOOLKIT_API FUnionGraph : public TSharedFromThis<FUnionGraph>
 	{
 	public:
-		TMap<uint32, TSharedPtr<FUnionNode>> GridTree;
+		// Grid fusing is split across independent shards, selected from the cell key, so concurrent
+		// insertions only contend when they land in the same shard.
+		static constexpr int32 NumShardsLog2 = 6;
+		static constexpr int32 NumShards = 1 << NumShardsLog2;
+
+		struct FShard
+		{
+			FRWLock Lock;
+			TMap<uint32, FUnionNode*> Cells;
+			FUnionNodePool Pool;
+		};
+
+	protected:
+		FShard Shards[NumShards];
+		std::atomic<int32> NumInsertedNodes{0};
+		std::atomic<bool> bConcurrentInsertion{false};
+		bool bCollapsed = false;
 
+	public:
 		TSharedPtr<PCGExData::FUnionMetadata> NodesUnion;
 		TSharedPtr<PCGExData::FUnionMetadata> EdgesUnion;
-		TArray<TSharedPtr<FUnionNode>> Nodes;
+		TArray<FUnionNode*> Nodes; // Only valid after Collapse()
 		TMap<uint64, FEdge> Edges;
 
 		FPCGExFuseDetails FuseDetails;
@@ -197,14 +251,28 @@ namespace PCGExGraph
 		int32 NumNodes() const { return NodesUnion->Num(); }
 		int32 NumEdges() const { return EdgesUnion->Num(); }
 
-		TSharedPtr<FUnionNode> InsertPoint(const PCGExData::FConstPoint& Point);
-		TSharedPtr<FUnionNode> InsertPoint_Unsafe(const PCGExData::FConstPoint& Point);
+		FUnionNode* InsertPoint(const PCGExData::FConstPoint& Point);
+		FUnionNode* InsertPoint_Unsafe(const PCGExData::FConstPoint& Point);
 		TSharedPtr<PCGExData::IUnionData> InsertEdge(const PCGExData::FConstPoint& From, const PCGExData::FConstPoint& To, const PCGExData::FConstPoint& Edge = PCGExData::NONE_ConstPoint);
 		TSharedPtr<PCGExData::IUnionData> InsertEdge_Unsafe(const PCGExData::FConstPoint& From, const PCGExData::FConstPoint& To, const PCGExData::FConstPoint& Edge = PCGExData::NONE_ConstPoint);
+
+		/**
+		 * Gathers pooled nodes into Nodes & NodesUnion. Must be called once insertion is complete, before reading nodes.
+		 * If points were inserted through the thread-safe API, nodes, edges and union elements are re-sorted
+		 * so the result is identical regardless of thread count or scheduling.
+		 */
+		void Collapse();
+
 		void GetUniqueEdges(TSet<uint64>& OutEdges);
 		void GetUniqueEdges(TArray<FEdge>& OutEdges);
 		void WriteNodeMetadata(const TSharedPtr<FGraph>& InGraph) const;
 		void WriteEdgeMetadata(const TSharedPtr<FGraph>& InGraph) const;
+
+	protected:
+		FORCEINLINE FShard& GetShard(const uint32 GridKey) { return Shards[(GridKey * 0x9E3779B1u) >> (32 - NumShardsLog2)]; }
+
+		FUnionNode* NewNode_Unsafe(FShard& Shard, const PCGExData::FConstPoint& Point, const FVector& Origin);
+		FUnionNode* FindOctreeNode_Unsafe(const PCGExData::FConstPoint& Point, const FVector& Origin) const;
 	};
 
 #pragma endregion
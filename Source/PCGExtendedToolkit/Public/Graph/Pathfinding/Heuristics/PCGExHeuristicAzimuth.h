@@ -41,6 +41,8 @@ public:
 		const PCGExCluster::FNode& Seed,
 		const PCGExCluster::FNode& Goal,
 		const TSharedPtr<PCGEx::FHashLookup> TravelStack) const override;
+
+	virtual bool UsesGoal() const override { return true; }
 };
 
 ////
@@ -62,6 +62,8 @@ public:
 		const PCGExCluster::FNode& Seed,
 		const PCGExCluster::FNode& Goal,
 		const TSharedPtr<PCGEx::FHashLookup> TravelStack) const override;
+
+	virtual bool UsesTravelStack() const override { return true; }
 };
 
 ////
@@ -0,0 +1,98 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Graph/PCGExCluster.h"
+#include "UObject/Object.h"
+#include "PCGExHeuristicOperation.h"
+#include "PCGExHeuristicsFactoryProvider.h"
+
+
+#include "PCGExHeuristicLandmarks.generated.h"
+
+USTRUCT(BlueprintType)
+struct FPCGExHeuristicConfigLandmarks : public FPCGExHeuristicConfigBase
+{
+	GENERATED_BODY()
+
+	FPCGExHeuristicConfigLandmarks() :
+		FPCGExHeuristicConfigBase()
+	{
+	}
+
+	/** Number of landmarks per cluster. Each landmark costs a full Dijkstra on first use & one double per node; more landmarks give tighter estimates. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, ClampMin=1))
+	int32 NumLandmarks = 8;
+};
+
+/**
+ * ALT (A*, Landmarks, Triangle inequality).
+ * Edges are scored by their length, like shortest distance, but the estimate toward the goal is a lower bound
+ * on the remaining path length through the graph, rather than a straight line.
+ * Score curve & invert are ignored, as the bound only holds for raw edge lengths.
+ */
+class FPCGExHeuristicLandmarks : public FPCGExHeuristicOperation
+{
+public:
+	int32 NumLandmarks = 8;
+
+	virtual void PrepareForCluster(const TSharedPtr<const PCGExCluster::FCluster>& InCluster) override;
+
+	virtual double GetGlobalScore(
+		const PCGExCluster::FNode& From,
+		const PCGExCluster::FNode& Seed,
+		const PCGExCluster::FNode& Goal) const override;
+
+	virtual double GetEdgeScore(
+		const PCGExCluster::FNode& From,
+		const PCGExCluster::FNode& To,
+		const PCGExGraph::FEdge& Edge,
+		const PCGExCluster::FNode& Seed,
+		const PCGExCluster::FNode& Goal,
+		const TSharedPtr<PCGEx::FHashLookup> TravelStack) const override;
+
+protected:
+	TSharedPtr<PCGExCluster::FLandmarks> Landmarks;
+};
+
+////
+
+UCLASS(MinimalAPI, BlueprintType, ClassGroup = (Procedural), Category="PCGEx|Data")
+class UPCGExHeuristicsFactoryLandmarks : public UPCGExHeuristicsFactoryData
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	FPCGExHeuristicConfigLandmarks Config;
+
+	virtual TSharedPtr<FPCGExHeuristicOperation> CreateOperation(FPCGExContext* InContext) const override;
+	PCGEX_HEURISTIC_FACTORY_BOILERPLATE
+};
+
+UCLASS(MinimalAPI, BlueprintType, ClassGroup = (Procedural), Category="PCGEx|Graph|Params", meta=(PCGExNodeLibraryDoc="pathfinding/heuristics/hx-landmarks"))
+class UPCGExHeuristicsLandmarksProviderSettings : public UPCGExHeuristicsFactoryProviderSettings
+{
+	GENERATED_BODY()
+
+public:
+	//~Begin UPCGSettings
+#if WITH_EDITOR
+	PCGEX_NODE_INFOS_CUSTOM_SUBTITLE(
+		HeuristicsLandmarks, "Heuristics : Landmarks", "Shortest distance, with landmark-based (ALT) estimates of the remaining path length. Much tighter than straight-line distance on winding networks.",
+		FName(GetDisplayName()))
+#endif
+	//~End UPCGSettings
+
+	/** Filter Config.*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, ShowOnlyInnerProperties))
+	FPCGExHeuristicConfigLandmarks Config;
+
+	virtual UPCGExFactoryData* CreateFactory(FPCGExContext* InContext, UPCGExFactoryData* InFactory) const override;
+
+#if WITH_EDITOR
+	virtual FString GetDisplayName() const override;
+#endif
+};
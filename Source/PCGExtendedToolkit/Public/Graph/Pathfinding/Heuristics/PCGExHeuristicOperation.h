@@ -46,6 +46,12 @@ public:
 		const PCGExCluster::FNode& Goal,
 		const TSharedPtr<PCGEx::FHashLookup> TravelStack = nullptr) const;
 
+	/** Whether edge scores depend on the query goal. Searches answering several goals at once can't honor those. */
+	virtual bool UsesGoal() const;
+
+	/** Whether edge scores depend on the path walked so far, read back from the travel stack. */
+	virtual bool UsesTravelStack() const;
+
 
 	double GetCustomWeightMultiplier(const int32 PointIndex, const int32 EdgeIndex) const;
 
@@ -94,6 +94,12 @@ namespace PCGExHeuristics
 		bool HasLocalFeedback() const { return !LocalFeedbackFactories.IsEmpty(); };
 		bool HasAnyFeedback() const { return HasGlobalFeedback() || HasLocalFeedback(); };
 
+		/** Whether edge scores ignore the query goal, so a single expansion can answer several goals. */
+		bool IsGoalAgnostic() const;
+
+		/** Whether edge scores ignore the path walked so far, so a search can be expanded from the goal instead. */
+		bool IsTravelAgnostic() const;
+
 		FHeuristicsHandler(FPCGExContext* InContext, const TSharedPtr<PCGExData::FFacade>& InVtxDataCache, const TSharedPtr<PCGExData::FFacade>& InEdgeDataCache, const TArray<TObjectPtr<const UPCGExHeuristicsFactoryData>>& InFactories);
 		~FHeuristicsHandler();
 
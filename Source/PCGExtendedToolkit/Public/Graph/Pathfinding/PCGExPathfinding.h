@@ -12,6 +12,11 @@
 
 struct FPCGExNodeSelectionDetails;
 
+namespace PCGEx
+{
+	class FHashLookupStamped;
+}
+
 namespace PCGExCluster
 {
 	class FCluster;
@@ -185,6 +190,11 @@ namespace PCGExPathfinding
 			const TSharedPtr<PCGExHeuristics::FHeuristicsHandler>& HeuristicsHandler,
 			const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback);
 
+		/** Read the path from a shared travel stack, rooted at the seed, or at the goal when bRootedAtGoal. */
+		void FindPath(
+			PCGEx::FHashLookupStamped* TravelStack,
+			const bool bRootedAtGoal = false);
+
 		void AppendNodePoints(
 			TArray<int32>& OutPoints,
 			const int32 TruncateStart = 0,
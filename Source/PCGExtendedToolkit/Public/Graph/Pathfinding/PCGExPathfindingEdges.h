@@ -14,6 +14,20 @@
 #include "PCGExPathfindingEdges.generated.h"
 
 class UPCGExSearchInstancedFactory;
+
+namespace PCGExSearch
+{
+	class FSearchAllocations;
+}
+
+UENUM()
+enum class EPCGExPathfindingBatching : uint8
+{
+	None        = 0 UMETA(DisplayName = "None", Tooltip="One search per seed/goal pair."),
+	Grouped     = 1 UMETA(DisplayName = "Grouped", Tooltip="Pairs sharing a seed (or a goal) are all answered by a single Dijkstra expansion."),
+	NearestSeed = 2 UMETA(DisplayName = "Nearest Seed", Tooltip="Single Dijkstra expansion from all seeds at once; each goal gets a single path, from the seed that reaches it for the lowest score."),
+};
+
 /**
  * Use PCGExTransform to manipulate the outgoing attributes instead of handling everything here.
  * This way we can multi-thread the various calculations instead of mixing everything along with async/game thread collision
@@ -75,6 +89,11 @@ public:
 	UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = Settings, Instanced, meta = (PCG_Overridable, NoResetToDefault, ShowOnlyInnerProperties))
 	TObjectPtr<UPCGExSearchInstancedFactory> SearchAlgorithm;
 
+	/** Share search expansions between queries. Batched searches ignore the search algorithm and always expand as Dijkstra.
+	 * Falls back to individual searches if heuristics depend on the goal (i.e Azimuth) or use feedback. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
+	EPCGExPathfindingBatching Batching = EPCGExPathfindingBatching::None;
+
 	/** TBD */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Tagging & Forwarding")
 	FPCGExAttributeToTagDetails SeedAttributesToPathTags;
@@ -145,6 +164,10 @@ namespace PCGExPathfindingEdges
 	{
 		TArray<TSharedPtr<PCGExPathfinding::FPathQuery>> Queries;
 
+		bool bReverseGroups = false;
+		TArray<TArray<int32>> QueryGroups;
+		TSharedPtr<PCGExSearch::FSearchAllocations> SharedSearch;
+
 	public:
 		FProcessor(const TSharedRef<PCGExData::FFacade>& InVtxDataFacade, const TSharedRef<PCGExData::FFacade>& InEdgeDataFacade):
 			TProcessor(InVtxDataFacade, InEdgeDataFacade)
@@ -157,5 +180,10 @@ namespace PCGExPathfindingEdges
 		TSharedPtr<FPCGExSearchOperation> SearchOperation;
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InAsyncManager) override;
+
+	protected:
+		void StartGroupedSearches();
+		void StartNearestSeedSearch();
+		void ResolveQuery(const TSharedPtr<PCGExPathfinding::FPathQuery>& Query, PCGEx::FHashLookupStamped* TravelStack, const bool bRootedAtGoal) const;
 	};
 }
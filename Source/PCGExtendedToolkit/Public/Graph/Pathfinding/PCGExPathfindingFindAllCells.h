@@ -98,14 +98,14 @@ namespace PCGExFindAllCells
 {
 	class FProcessor final : public PCGExClusterMT::TProcessor<FPCGExFindAllCellsContext, UPCGExFindAllCellsSettings>
 	{
-		int32 NumAttempts = 0;
-		int32 LastBinary = -1;
 		int32 OutputPathsNum = 0;
+		int32 WrapperFace = -1;
 
 	protected:
 		TSharedPtr<PCGExTopology::FHoles> Holes;
 		bool bBuildExpandedNodes = false;
 		TSharedPtr<PCGExTopology::FCell> WrapperCell;
+		TSharedPtr<PCGExTopology::FHalfEdgeGraph> HalfEdges;
 
 	public:
 		TSharedPtr<PCGExTopology::FCellConstraints> CellsConstraints;
@@ -118,11 +118,8 @@ namespace PCGExFindAllCells
 		virtual ~FProcessor() override;
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InAsyncManager) override;
-		virtual void ProcessEdges(const PCGExMT::FScope& Scope) override;
-		bool FindCell(const PCGExCluster::FNode& Node, const PCGExGraph::FEdge& Edge, const bool bSkipBinary = true);
+		virtual void ProcessRange(const PCGExMT::FScope& Scope) override;
 		void ProcessCell(const TSharedPtr<PCGExTopology::FCell>& InCell);
-		void EnsureRoamingClosedLoopProcessing();
-		virtual void OnEdgesProcessingComplete() override;
 		virtual void CompleteWork() override;
 		virtual void Cleanup() override;
 	};
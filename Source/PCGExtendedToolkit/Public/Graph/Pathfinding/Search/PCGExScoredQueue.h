@@ -6,6 +6,8 @@
 #include <queue>
 #include <vector>
 
+#include "PCGExH.h"
+
 namespace PCGExSearch
 {
 	class FScoredQueue
@@ -31,11 +33,22 @@ namespace PCGExSearch
 			bool operator>(const FScoredNode& Other) const { return Score > Other.Score; }
 		};
 
+		struct FQueue : std::priority_queue<FScoredNode, std::vector<FScoredNode>, std::greater<FScoredNode>>
+		{
+			// Drop content but keep the underlying storage around
+			void Clear() { this->c.clear(); }
+		};
+
 	protected:
-		std::priority_queue<FScoredNode, std::vector<FScoredNode>, std::greater<FScoredNode>> InternalQueue;
+		FQueue InternalQueue;
 
 	public:
-		TArray<double> Scores;
+		PCGEx::TStampedArray<double> Scores;
+
+		explicit FScoredQueue(const int32 Size)
+		{
+			Scores.Init(MAX_dbl, Size);
+		}
 
 		FScoredQueue(const int32 Size, const int32& Item, const double Score)
 		{
@@ -45,16 +58,23 @@ namespace PCGExSearch
 
 		~FScoredQueue()
 		{
-			std::priority_queue<FScoredNode, std::vector<FScoredNode>, std::greater<FScoredNode>> EmptyQueue;
+			FQueue EmptyQueue;
 			std::swap(InternalQueue, EmptyQueue);
 		}
 
+		/** Clears the queue & scores in O(1), then enqueue the given item. */
+		void Reset(const int32 Item, const double Score)
+		{
+			InternalQueue.Clear();
+			Scores.Reset();
+			Enqueue(Item, Score);
+		}
+
 		bool Enqueue(const int32 Index, const double InScore)
 		{
-			double& RegisteredScore = Scores[Index];
-			if (RegisteredScore <= InScore) { return false; }
+			if (Scores.Get(Index) <= InScore) { return false; }
 
-			RegisteredScore = InScore;
+			Scores.Set(Index, InScore);
 			InternalQueue.push(FScoredNode(Index, InScore));
 			return true;
 		}
@@ -68,7 +88,7 @@ namespace PCGExSearch
 				const FScoredNode TopNode = InternalQueue.top();
 				InternalQueue.pop();
 
-				if (TopNode.Score == Scores[TopNode.Id])
+				if (TopNode.Score == Scores.Get(TopNode.Id))
 				{
 					Item = TopNode.Id;
 					OutScore = TopNode.Score;
@@ -0,0 +1,36 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGExSearchAStar.h"
+
+
+#include "UObject/Object.h"
+#include "PCGExSearchBidirectionalAStar.generated.h"
+
+class FPCGExSearchOperationBidirectionalAStar : public FPCGExSearchOperationAStar
+{
+public:
+	virtual bool ResolveQuery(
+		const TSharedPtr<PCGExPathfinding::FPathQuery>& InQuery,
+		const TSharedPtr<PCGExHeuristics::FHeuristicsHandler>& Heuristics,
+		const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback = nullptr) const override;
+};
+
+/**
+ * 
+ */
+UCLASS(MinimalAPI, meta=(DisplayName = "Bidirectional A*", ToolTip ="A* Search grown from both seed & goal until the two frontiers meet. Falls back to regular A* when a heuristic depends on the path travelled so far.", PCGExNodeLibraryDoc="pathfinding/search-algorithms/a-a-star"))
+class UPCGExSearchBidirectionalAStar : public UPCGExSearchInstancedFactory
+{
+	GENERATED_BODY()
+
+public:
+	virtual TSharedPtr<FPCGExSearchOperation> CreateOperation() const override
+	{
+		PCGEX_FACTORY_NEW_OPERATION(SearchOperationBidirectionalAStar)
+		return NewOperation;
+	}
+};
@@ -10,6 +10,7 @@
 #include "Graph/PCGExCluster.h"
 #include "Graph/Pathfinding/PCGExPathfinding.h"
 #include "Graph/Pathfinding/Heuristics/PCGExHeuristics.h"
+#include "PCGExScoredQueue.h"
 #include "UObject/Object.h"
 #include "PCGExSearchOperation.generated.h"
 
@@ -25,6 +26,32 @@ namespace PCGExCluster
 	class FCluster;
 }
 
+namespace PCGExSearch
+{
+	/**
+	 * Working memory for a single search, sized to a cluster.
+	 * Recycled between queries; Reset() invalidates previous state in O(1).
+	 */
+	class PCGEXTENDEDTOOLKIT_API FSearchAllocations : public TSharedFromThis<FSearchAllocations>
+	{
+	protected:
+		int32 NumNodes = 0;
+
+	public:
+		PCGEx::TStampedArray<bool> Visited;
+		PCGEx::TStampedArray<double> GScore;
+		TSharedPtr<PCGEx::FHashLookup> TravelStack;       // Shared with heuristics
+		PCGEx::FHashLookupStamped* TypedTravelStack = nullptr; // Same object, non-virtual access for the search loop
+		TUniquePtr<FScoredQueue> ScoredQueue;
+
+		explicit FSearchAllocations(const int32 InNumNodes);
+		~FSearchAllocations() = default;
+
+		int32 GetNumNodes() const { return NumNodes; }
+		void Reset();
+	};
+}
+
 class FPCGExSearchOperation : public FPCGExOperation
 {
 public:
@@ -36,6 +63,26 @@ public:
 		const TSharedPtr<PCGExPathfinding::FPathQuery>& InQuery,
 		const TSharedPtr<PCGExHeuristics::FHeuristicsHandler>& Heuristics,
 		const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback = nullptr) const;
+
+	/**
+	 * Single Dijkstra expansion from all roots at once, until every target is settled (or the whole cluster, if there are no targets).
+	 * The returned allocations' travel stack holds a shortest-path tree toward the roots, to be read by as many queries as needed;
+	 * release them once done. With bReverse, roots are goals and edges are scored as walked toward them.
+	 * Heuristics must be goal-agnostic, and travel-agnostic as well when reversed.
+	 */
+	TSharedPtr<PCGExSearch::FSearchAllocations> ExpandFrom(
+		const TArray<int32>& Roots,
+		const TArray<int32>& Targets,
+		const TSharedPtr<PCGExHeuristics::FHeuristicsHandler>& Heuristics,
+		const bool bReverse = false) const;
+
+	/** Grab reset search allocations from the pool, or create new ones. Each concurrent query gets its own. */
+	TSharedPtr<PCGExSearch::FSearchAllocations> AcquireAllocations() const;
+	void ReleaseAllocations(const TSharedPtr<PCGExSearch::FSearchAllocations>& InAllocations) const;
+
+protected:
+	mutable FRWLock PoolLock;
+	mutable TArray<TSharedPtr<PCGExSearch::FSearchAllocations>> AllocationsPool;
 };
 
 /**
@@ -112,6 +112,7 @@ namespace PCGExPointFilter
 
 		virtual bool Test(const PCGExData::FProxyPoint& Point) const override;
 		virtual bool Test(const int32 PointIndex) const override;
+		virtual void TestRange(const PCGExMT::FScope& Scope, TArrayView<int8> InOutMask) const override;
 		virtual bool Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const override;
 
 		virtual ~FDistanceFilter() override
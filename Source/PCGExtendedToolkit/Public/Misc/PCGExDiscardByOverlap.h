@@ -98,6 +98,11 @@ struct FPCGExOverlapScoresWeighting
 	void Init();
 	void ResetMin();
 	void Max(const FPCGExOverlapScoresWeighting& Other);
+
+	/** Whether any of the raw scores used for max tracking is equal to the one in Other */
+	bool AnyScoreEquals(const FPCGExOverlapScoresWeighting& Other) const;
+	/** Whether all of the raw scores used for max tracking are equal to the ones in Other */
+	bool AllScoresEqual(const FPCGExOverlapScoresWeighting& Other) const;
 };
 
 namespace PCGExDiscardByOverlap
@@ -105,6 +110,7 @@ namespace PCGExDiscardByOverlap
 	struct FOverlapStats;
 	class FOverlap;
 	class FProcessor;
+	class FPruningQueue;
 }
 
 UCLASS(MinimalAPI, BlueprintType, ClassGroup = (Procedural), Category="PCGEx|Misc", meta=(PCGExNodeLibraryDoc="filters/discard-by-overlap"))
@@ -322,6 +328,9 @@ namespace PCGExDiscardByOverlap
 
 		FOverlapStats Stats;
 
+		int32 QueueIndex = -1;
+		bool bQueueDirty = false;
+
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade)
 			: TProcessor(InPointDataFacade)
 		{
@@ -334,8 +343,8 @@ namespace PCGExDiscardByOverlap
 		FORCEINLINE bool HasOverlaps() const { return !Overlaps.IsEmpty(); }
 
 		void RegisterOverlap(FProcessor* InOtherProcessor, const FBox& Intersection);
-		void RemoveOverlap(const TSharedPtr<FOverlap>& InOverlap, TArray<FProcessor*>& Stack);
-		void Prune(TArray<FProcessor*>& Stack);
+		void RemoveOverlap(const TSharedPtr<FOverlap>& InOverlap, FPruningQueue& Queue);
+		void Prune(FPruningQueue& Queue);
 
 		void RegisterPointBounds(const int32 Index, const TSharedPtr<FPointBounds>& InPointBounds)
 		{
@@ -358,4 +367,49 @@ namespace PCGExDiscardByOverlap
 		void UpdateWeightValues();
 		void UpdateWeight(const FPCGExOverlapScoresWeighting& InMax);
 	};
+
+	/**
+	 * Indexed binary heap of processors still pending pruning.
+	 * Processors whose scores change are flagged dirty and re-keyed in place,
+	 * and the max scores are only recomputed when a processor that held one of them changes.
+	 */
+	class FPruningQueue
+	{
+	protected:
+		TArray<FProcessor*> Heap;
+		TArray<FProcessor*> Dirty;
+		EPCGExOverlapPruningLogic Logic = EPCGExOverlapPruningLogic::HighFirst;
+		const FPCGExOverlapScoresWeighting* MaxScores = nullptr;
+		bool bMaxScoresDirty = false;
+
+	public:
+		FPruningQueue(const EPCGExOverlapPruningLogic InLogic, const FPCGExOverlapScoresWeighting* InMaxScores)
+			: Logic(InLogic), MaxScores(InMaxScores)
+		{
+		}
+
+		FORCEINLINE bool IsEmpty() const { return Heap.IsEmpty(); }
+		FORCEINLINE const TArray<FProcessor*>& GetProcessors() const { return Heap; }
+		FORCEINLINE const TArray<FProcessor*>& GetDirty() const { return Dirty; }
+		FORCEINLINE bool IsMaxScoresDirty() const { return bMaxScoresDirty; }
+
+		void Reserve(const int32 Num);
+		void Add(FProcessor* InProcessor);
+		FProcessor* Pop();
+		void Remove(FProcessor* InProcessor);
+
+		/** Must be called before the scores of a queued processor (or one that just left the queue) change. */
+		void Touch(FProcessor* InProcessor);
+		/** Re-key dirty processors only */
+		void UpdateDirty();
+		/** Re-key everything */
+		void Heapify();
+		void ClearDirty();
+
+	protected:
+		bool IsBetter(const FProcessor* A, const FProcessor* B) const;
+		void Place(const int32 Index, FProcessor* InProcessor);
+		void SiftUp(int32 Index);
+		void SiftDown(int32 Index);
+	};
 }
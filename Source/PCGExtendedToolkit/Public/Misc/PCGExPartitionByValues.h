@@ -45,6 +45,57 @@ namespace PCGExPartition
 
 		void SortPartitions();
 	};
+
+	/** Full key path of a point, one value per rule */
+	struct FPartitionKey
+	{
+		TArray<int64, TInlineAllocator<4>> Keys;
+
+		FORCEINLINE bool operator==(const FPartitionKey& Other) const { return Keys == Other.Keys; }
+
+		friend FORCEINLINE uint32 GetTypeHash(const FPartitionKey& Key)
+		{
+			uint32 Hash = 0;
+			for (const int64 K : Key.Keys) { Hash = HashCombineFast(Hash, GetTypeHash(K)); }
+			return Hash;
+		}
+	};
+
+	/**
+	 * Scope-local key histogram.
+	 * Filled without any synchronization during the parallel pass, then merged into the partition tree.
+	 */
+	struct FScopeHistogram
+	{
+		PCGExMT::FScope Scope;
+
+		TMap<FPartitionKey, int32> LeafIndices;
+		TArray<FPartitionKey> Keys;
+		TArray<int32> Counts;
+
+		// Resolved during merge
+		TArray<FKPartition*> Partitions;
+		TArray<int32> Offsets; // Write cursor into each partition Points
+
+		explicit FScopeHistogram(const PCGExMT::FScope& InScope)
+			: Scope(InScope)
+		{
+		}
+
+		FORCEINLINE int32 Add(const FPartitionKey& Key)
+		{
+			if (const int32* Existing = LeafIndices.Find(Key))
+			{
+				Counts[*Existing]++;
+				return *Existing;
+			}
+
+			const int32 LeafIndex = Keys.Add(Key);
+			Counts.Add(1);
+			LeafIndices.Add(Key, LeafIndex);
+			return LeafIndex;
+		}
+	};
 }
 
 
@@ -144,6 +195,10 @@ namespace PCGExPartitionByValuesBase
 
 		TSharedPtr<PCGExPartition::FKPartition> RootPartition;
 
+		// Two-pass partitioning : per-scope histograms, single merge, then parallel scatter
+		TArray<TSharedPtr<PCGExPartition::FScopeHistogram>> Histograms; // One per loop scope
+		TArray<int32> LeafIndices; // Per-point leaf index, local to its scope histogram
+
 		int32 NumPartitions = -1;
 		TArray<TSharedPtr<PCGExPartition::FKPartition>> Partitions;
 
@@ -154,7 +209,9 @@ namespace PCGExPartitionByValuesBase
 		}
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InAsyncManager) override;
+		virtual void PrepareLoopScopesForPoints(const TArray<PCGExMT::FScope>& Loops) override;
 		virtual void ProcessPoints(const PCGExMT::FScope& Scope) override;
+		virtual void OnPointsProcessingComplete() override;
 		virtual void ProcessRange(const PCGExMT::FScope& Scope) override;
 		virtual void CompleteWork() override;
 	};
@@ -399,10 +399,48 @@ namespace PCGExCompare
 		}
 	}
 
+	/**
+	 * Columnar Compare, OutResults[i] = Compare(Method, A[i], B[i], Tolerance).
+	 * The method switch is resolved once for the whole range.
+	 */
+	template <typename T>
+	static void CompareRange(const EPCGExComparison Method, const TConstArrayView<T> A, const TConstArrayView<T> B, TArrayView<int8> OutResults, const double Tolerance = DBL_COMPARE_TOLERANCE)
+	{
+		const int32 Num = OutResults.Num();
+		const T* RESTRICT VA = A.GetData();
+		const T* RESTRICT VB = B.GetData();
+		int8* RESTRICT R = OutResults.GetData();
+
+#define PCGEX_COMPARE_RANGE(_OP) for (int32 i = 0; i < Num; i++) { R[i] = _OP(VA[i], VB[i]); } break;
+
+		switch (Method)
+		{
+		case EPCGExComparison::StrictlyEqual: PCGEX_COMPARE_RANGE(StrictlyEqual)
+		case EPCGExComparison::StrictlyNotEqual: PCGEX_COMPARE_RANGE(StrictlyNotEqual)
+		case EPCGExComparison::EqualOrGreater: PCGEX_COMPARE_RANGE(EqualOrGreater)
+		case EPCGExComparison::EqualOrSmaller: PCGEX_COMPARE_RANGE(EqualOrSmaller)
+		case EPCGExComparison::StrictlyGreater: PCGEX_COMPARE_RANGE(StrictlyGreater)
+		case EPCGExComparison::StrictlySmaller: PCGEX_COMPARE_RANGE(StrictlySmaller)
+		case EPCGExComparison::NearlyEqual:
+			for (int32 i = 0; i < Num; i++) { R[i] = NearlyEqual(VA[i], VB[i], Tolerance); }
+			break;
+		case EPCGExComparison::NearlyNotEqual:
+			for (int32 i = 0; i < Num; i++) { R[i] = NearlyNotEqual(VA[i], VB[i], Tolerance); }
+			break;
+		default: FMemory::Memzero(R, Num);
+			break;
+		}
+
+#undef PCGEX_COMPARE_RANGE
+	}
+
 	bool Compare(const EPCGExComparison Method, const TSharedPtr<PCGExData::IDataValue>& A, const double B, const double Tolerance = DBL_COMPARE_TOLERANCE);
 	bool Compare(const EPCGExStringComparison Method, const TSharedPtr<PCGExData::IDataValue>& A, const FString B);
 	bool Compare(const EPCGExBitflagComparison Method, const int64& Flags, const int64& Mask);
 
+	// Columnar bitflag Compare, OutResults[i] = Compare(Method, Flags[i], Masks[i])
+	void CompareRange(const EPCGExBitflagComparison Method, const TConstArrayView<int64> Flags, const TConstArrayView<int64> Masks, TArrayView<int8> OutResults);
+
 	bool HasMatchingTags(const TSharedPtr<PCGExData::FTags>& InTags, const FString& Query, const EPCGExStringMatchMode MatchMode, const bool bStrict = true);
 	bool GetMatchingValueTags(const TSharedPtr<PCGExData::FTags>& InTags, const FString& Query, const EPCGExStringMatchMode MatchMode, TArray<TSharedPtr<PCGExData::IDataValue>>& OutValues);
 }
@@ -18,6 +18,7 @@ struct FAttachmentTransformRules;
 namespace PCGExMT
 {
 	class FTaskManager;
+	class FTelemetry;
 }
 
 namespace PCGEx
@@ -67,6 +68,9 @@ public:
 
 	TSharedPtr<PCGExMT::FTaskManager> GetAsyncManager();
 
+	/** Task group timings for this context, only valid when bTaskGroupTelemetry is enabled */
+	TSharedPtr<PCGExMT::FTelemetry> TaskTelemetry;
+
 	void PauseContext();
 	void UnpauseContext();
 
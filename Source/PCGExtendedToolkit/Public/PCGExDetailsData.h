@@ -6,6 +6,7 @@
 #include "CoreMinimal.h"
 #include "PCGEx.h"
 #include "PCGExMacros.h"
+#include "PCGExMT.h"
 #include "Metadata/PCGAttributePropertySelector.h"
 
 #include "PCGExDetailsData.generated.h"
@@ -78,6 +79,12 @@ namespace PCGExDetails
 
 		FORCEINLINE virtual bool IsConstant() { return false; }
 		FORCEINLINE virtual T Read(const int32 Index) = 0;
+
+		// Bulk read, OutValues[i] = Read(Scope.Start + i)
+		virtual void ReadScope(const PCGExMT::FScope& Scope, TArrayView<T> OutValues)
+		{
+			for (int i = 0; i < Scope.Count; i++) { OutValues[i] = Read(Scope.Start + i); }
+		}
 		FORCEINLINE virtual T Min() = 0;
 		FORCEINLINE virtual T Max() = 0;
 	};
@@ -98,6 +105,7 @@ namespace PCGExDetails
 		virtual bool Init(const TSharedPtr<PCGExData::FFacade>& InDataFacade, const bool bSupportScoped = true, const bool bCaptureMinMax = false) override;
 
 		virtual T Read(const int32 Index) override;
+		virtual void ReadScope(const PCGExMT::FScope& Scope, TArrayView<T> OutValues) override;
 		virtual T Min() override;
 		virtual T Max() override;
 	};
@@ -118,6 +126,7 @@ namespace PCGExDetails
 		virtual bool Init(const TSharedPtr<PCGExData::FFacade>& InDataFacade, const bool bSupportScoped = true, const bool bCaptureMinMax = false) override;
 
 		virtual T Read(const int32 Index) override;
+		virtual void ReadScope(const PCGExMT::FScope& Scope, TArrayView<T> OutValues) override;
 		virtual T Min() override;
 		virtual T Max() override;
 	};
@@ -140,6 +149,7 @@ namespace PCGExDetails
 		FORCEINLINE virtual void SetConstant(T InConstant) override { Constant = InConstant; };
 
 		FORCEINLINE virtual T Read(const int32 Index) override { return Constant; }
+		virtual void ReadScope(const PCGExMT::FScope& Scope, TArrayView<T> OutValues) override { for (int i = 0; i < Scope.Count; i++) { OutValues[i] = Constant; } }
 		FORCEINLINE virtual T Min() override { return Constant; }
 		FORCEINLINE virtual T Max() override { return Constant; }
 	};
@@ -84,6 +84,14 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(EditCondition="bCacheClusters"))
 	bool bDefaultBuildAndCacheClusters = true;
 
+	/** Build a flat, contiguous copy of cluster adjacency next to nodes. Uses a bit more memory but makes neighbor traversal much more cache-friendly on large clusters. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster")
+	bool bBuildFlatClusterAdjacency = false;
+
+	/** Store a compiled, checksummed copy of cluster topology with edge data when it is saved (e.g. in a PCG data asset), so loaded clusters don't need to be rebuilt. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster")
+	bool bPersistClusterCache = false;
+
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Points", meta=(ClampMin=1))
 	int32 SmallPointsSize = 1024;
 	bool IsSmallPointSize(const int32 InNum) const { return InNum <= SmallPointsSize; }
@@ -92,6 +100,15 @@ public:
 	int32 PointsDefaultBatchChunkSize = 1024;
 	int32 GetPointsBatchChunkSize(const int32 In = -1) const { return In <= -1 ? PointsDefaultBatchChunkSize : In; }
 
+	/** Materialize sorting rules into key columns and sort them in parallel. Much faster on large datasets, but tolerance is applied by quantization rather than a nearly-equal test, which may change the order of values that are within tolerance of each other. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Points")
+	bool bPrecomputeSortingKeys = false;
+
+	/** EXPERIMENTAL. Duplicated point array data inherits the input's properties and metadata instead of deep-copying them; only what gets written to is materialized. Saves a lot of memory and copies on large datasets.
+	 * Outputs are flattened before PCGEx resizes them, removes points or deletes attributes, but any code path that does so directly on the output data, bypassing that, may corrupt or lose inherited values. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Points", meta=(DisplayName="Copy On Write Duplicate (Experimental)"))
+	bool bCopyOnWriteDuplicate = false;
+
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Async")
 	EPCGExAsyncPriority DefaultWorkPriority = EPCGExAsyncPriority::BackgroundNormal;
 	EPCGExAsyncPriority GetDefaultWorkPriority() const { return DefaultWorkPriority == EPCGExAsyncPriority::Default ? EPCGExAsyncPriority::BackgroundNormal : DefaultWorkPriority; }
@@ -104,6 +121,10 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Debug")
 	bool bAssertOnEmptyThread = false;
 
+	/** If enabled, each node records wall, busy and queue-wait time along with task and scope counts per task group, and logs a summary when it completes. Cheap enough to leave on; useful to find imbalanced chunking. */
+	UPROPERTY(EditAnywhere, config, Category = "Debug")
+	bool bTaskGroupTelemetry = false;
+
 	/** Disable collision on new entries */
 	UPROPERTY(EditAnywhere, config, Category = "Collections")
 	bool bDisableCollisionByDefault = true;
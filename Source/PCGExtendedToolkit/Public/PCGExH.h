@@ -278,6 +278,69 @@ namespace PCGEx
 		FORCEINLINE bool Contains(const int32 Index) const { return Data.Contains(Index); }
 	};
 
+	/**
+	 * Fixed-size array that can be cleared in O(1).
+	 * Each slot remembers the generation it was last written in; slots from older generations read as the default value.
+	 */
+	template <typename T>
+	class TStampedArray
+	{
+	protected:
+		TArray<T> Values;
+		TArray<uint32> Stamps;
+		uint32 Generation = 1;
+		T DefaultValue = T{};
+
+	public:
+		TStampedArray() = default;
+
+		void Init(const T& InDefaultValue, const int32 InNum)
+		{
+			DefaultValue = InDefaultValue;
+			Generation = 1;
+			Values.SetNumUninitialized(InNum);
+			Stamps.Init(0, InNum);
+		}
+
+		void Reset()
+		{
+			if (++Generation == 0)
+			{
+				// Wrapped around, stamps must be cleared for real
+				FMemory::Memzero(Stamps.GetData(), Stamps.Num() * sizeof(uint32));
+				Generation = 1;
+			}
+		}
+
+		FORCEINLINE int32 Num() const { return Values.Num(); }
+		FORCEINLINE bool IsSet(const int32 At) const { return Stamps[At] == Generation; }
+		FORCEINLINE T Get(const int32 At) const { return Stamps[At] == Generation ? Values[At] : DefaultValue; }
+
+		FORCEINLINE void Set(const int32 At, const T& Value)
+		{
+			Values[At] = Value;
+			Stamps[At] = Generation;
+		}
+	};
+
+	class FHashLookupStamped final : public FHashLookup
+	{
+	protected:
+		TStampedArray<uint64> Data;
+
+	public:
+		explicit FHashLookupStamped(const uint64 InitValue, const int32 Size)
+			: FHashLookup(InitValue, Size)
+		{
+			Data.Init(InitValue, Size);
+		}
+
+		FORCEINLINE virtual void Set(const int32 At, const uint64 Value) override { Data.Set(At, Value); }
+		FORCEINLINE virtual uint64 Get(const int32 At) override { return Data.Get(At); }
+
+		FORCEINLINE void Reset() { Data.Reset(); }
+	};
+
 	template <typename T>
 	static TSharedPtr<FHashLookup> NewHashLookup(const uint64 InitValue, const int32 Size)
 	{
@@ -0,0 +1,259 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExKDTree
+{
+	struct PCGEXTENDEDTOOLKIT_API FItem
+	{
+		FVector Position = FVector::ZeroVector;
+		int32 IO = -1;
+		int32 Index = -1;
+
+		FItem() = default;
+
+		FItem(const FVector& InPosition, const int32 InIO, const int32 InIndex)
+			: Position(InPosition), IO(InIO), Index(InIndex)
+		{
+		}
+
+		// Stable ordering, used to break distance ties so results match a linear (IO, Index) scan
+		FORCEINLINE bool Precedes(const FItem& Other) const { return IO < Other.IO || (IO == Other.IO && Index < Other.Index); }
+	};
+
+	/**
+	 * Static, flat k-d tree over point positions.
+	 * Built once, then queried concurrently (queries are const and allocation-free except for k-nearest).
+	 * Distances are center-to-center squared euclidean, identical to FVector::DistSquared.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FPointKDTree : public TSharedFromThis<FPointKDTree>
+	{
+	public:
+		struct FNode
+		{
+			FBox Bounds = FBox(ForceInit);
+			int32 Start = 0; // First item in Items
+			int32 End = 0;   // One past last item in Items
+			int32 Left = -1;
+			int32 Right = -1;
+
+			FORCEINLINE bool IsLeaf() const { return Left == -1; }
+		};
+
+		static constexpr int32 MaxItemsPerLeaf = 8;
+
+	protected:
+		TArray<FNode> Nodes;
+		TArray<FItem> Items;
+
+	public:
+		FPointKDTree() = default;
+		explicit FPointKDTree(TArray<FItem>&& InItems);
+
+		FORCEINLINE int32 Num() const { return Items.Num(); }
+		FORCEINLINE bool IsEmpty() const { return Items.IsEmpty(); }
+		FORCEINLINE const FItem& GetItem(const int32 InIndex) const { return Items[InIndex]; }
+
+		/**
+		 * Nearest item for which Filter(Item) returns true.
+		 * @return index into the tree items, or -1
+		 */
+		template <typename FilterFunc>
+		int32 FindNearest(const FVector& Probe, double& OutDistSquared, FilterFunc&& Filter) const
+		{
+			int32 Best = -1;
+			OutDistSquared = MAX_dbl;
+			if (Nodes.IsEmpty()) { return Best; }
+
+			int32 Stack[64];
+			int32 StackSize = 0;
+			Stack[StackSize++] = 0;
+
+			while (StackSize)
+			{
+				const FNode& Node = Nodes[Stack[--StackSize]];
+
+				// Strict comparison keeps equidistant subtrees alive for deterministic tie-breaking
+				if (Node.Bounds.ComputeSquaredDistanceToPoint(Probe) > OutDistSquared) { continue; }
+
+				if (Node.IsLeaf())
+				{
+					for (int32 i = Node.Start; i < Node.End; i++)
+					{
+						const FItem& Item = Items[i];
+						const double Dist = FVector::DistSquared(Probe, Item.Position);
+
+						if (Dist > OutDistSquared) { continue; }
+						if (Dist == OutDistSquared && Best != -1 && !Item.Precedes(Items[Best])) { continue; }
+						if (!Filter(Item)) { continue; }
+
+						OutDistSquared = Dist;
+						Best = i;
+					}
+
+					continue;
+				}
+
+				// Visit closest child first
+				const double DL = Nodes[Node.Left].Bounds.ComputeSquaredDistanceToPoint(Probe);
+				const double DR = Nodes[Node.Right].Bounds.ComputeSquaredDistanceToPoint(Probe);
+
+				if (DL <= DR)
+				{
+					Stack[StackSize++] = Node.Right;
+					Stack[StackSize++] = Node.Left;
+				}
+				else
+				{
+					Stack[StackSize++] = Node.Left;
+					Stack[StackSize++] = Node.Right;
+				}
+			}
+
+			if (Best == -1) { OutDistSquared = 0; }
+			return Best;
+		}
+
+		/**
+		 * Farthest item for which Filter(Item) returns true.
+		 * @return index into the tree items, or -1
+		 */
+		template <typename FilterFunc>
+		int32 FindFarthest(const FVector& Probe, double& OutDistSquared, FilterFunc&& Filter) const
+		{
+			int32 Best = -1;
+			OutDistSquared = -1;
+			if (Nodes.IsEmpty()) { return Best; }
+
+			int32 Stack[64];
+			int32 StackSize = 0;
+			Stack[StackSize++] = 0;
+
+			while (StackSize)
+			{
+				const FNode& Node = Nodes[Stack[--StackSize]];
+
+				if (GetMaxDistSquared(Node.Bounds, Probe) < OutDistSquared) { continue; }
+
+				if (Node.IsLeaf())
+				{
+					for (int32 i = Node.Start; i < Node.End; i++)
+					{
+						const FItem& Item = Items[i];
+						const double Dist = FVector::DistSquared(Probe, Item.Position);
+
+						if (Dist < OutDistSquared) { continue; }
+						if (Dist == OutDistSquared && Best != -1 && !Item.Precedes(Items[Best])) { continue; }
+						if (!Filter(Item)) { continue; }
+
+						OutDistSquared = Dist;
+						Best = i;
+					}
+
+					continue;
+				}
+
+				// Visit farthest child first
+				const double DL = GetMaxDistSquared(Nodes[Node.Left].Bounds, Probe);
+				const double DR = GetMaxDistSquared(Nodes[Node.Right].Bounds, Probe);
+
+				if (DL >= DR)
+				{
+					Stack[StackSize++] = Node.Right;
+					Stack[StackSize++] = Node.Left;
+				}
+				else
+				{
+					Stack[StackSize++] = Node.Left;
+					Stack[StackSize++] = Node.Right;
+				}
+			}
+
+			if (Best == -1) { OutDistSquared = 0; }
+			return Best;
+		}
+
+		/**
+		 * Up to K nearest items for which Filter(Item) returns true, sorted by ascending distance.
+		 * OutResults holds (item index, squared distance) pairs.
+		 */
+		template <typename FilterFunc>
+		void FindKNearest(const FVector& Probe, const int32 K, TArray<TPair<int32, double>>& OutResults, FilterFunc&& Filter) const
+		{
+			OutResults.Reset();
+			if (Nodes.IsEmpty() || K <= 0) { return; }
+
+			OutResults.Reserve(K + 1);
+
+			// Sorted insertion; K is expected to be small
+			auto IsBetter = [&](const double Dist, const int32 Candidate, const TPair<int32, double>& Other)
+			{
+				return Dist < Other.Value || (Dist == Other.Value && Items[Candidate].Precedes(Items[Other.Key]));
+			};
+
+			double Worst = MAX_dbl;
+
+			int32 Stack[64];
+			int32 StackSize = 0;
+			Stack[StackSize++] = 0;
+
+			while (StackSize)
+			{
+				const FNode& Node = Nodes[Stack[--StackSize]];
+
+				if (Node.Bounds.ComputeSquaredDistanceToPoint(Probe) > Worst) { continue; }
+
+				if (Node.IsLeaf())
+				{
+					for (int32 i = Node.Start; i < Node.End; i++)
+					{
+						const double Dist = FVector::DistSquared(Probe, Items[i].Position);
+						if (Dist > Worst) { continue; }
+						if (OutResults.Num() == K && !IsBetter(Dist, i, OutResults.Last())) { continue; }
+						if (!Filter(Items[i])) { continue; }
+
+						int32 InsertAt = OutResults.Num();
+						while (InsertAt > 0 && IsBetter(Dist, i, OutResults[InsertAt - 1])) { InsertAt--; }
+						OutResults.Insert(TPair<int32, double>(i, Dist), InsertAt);
+
+						if (OutResults.Num() > K) { OutResults.Pop(EAllowShrinking::No); }
+						if (OutResults.Num() == K) { Worst = OutResults.Last().Value; }
+					}
+
+					continue;
+				}
+
+				const double DL = Nodes[Node.Left].Bounds.ComputeSquaredDistanceToPoint(Probe);
+				const double DR = Nodes[Node.Right].Bounds.ComputeSquaredDistanceToPoint(Probe);
+
+				if (DL <= DR)
+				{
+					Stack[StackSize++] = Node.Right;
+					Stack[StackSize++] = Node.Left;
+				}
+				else
+				{
+					Stack[StackSize++] = Node.Left;
+					Stack[StackSize++] = Node.Right;
+				}
+			}
+		}
+
+		int32 FindNearest(const FVector& Probe, double& OutDistSquared) const { return FindNearest(Probe, OutDistSquared, [](const FItem&) { return true; }); }
+		int32 FindFarthest(const FVector& Probe, double& OutDistSquared) const { return FindFarthest(Probe, OutDistSquared, [](const FItem&) { return true; }); }
+		void FindKNearest(const FVector& Probe, const int32 K, TArray<TPair<int32, double>>& OutResults) const { FindKNearest(Probe, K, OutResults, [](const FItem&) { return true; }); }
+
+	protected:
+		static FORCEINLINE double GetMaxDistSquared(const FBox& Box, const FVector& Probe)
+		{
+			const FVector A = (Probe - Box.Min).GetAbs();
+			const FVector B = (Probe - Box.Max).GetAbs();
+			return FVector(FMath::Max(A.X, B.X), FMath::Max(A.Y, B.Y), FMath::Max(A.Z, B.Z)).SizeSquared();
+		}
+
+		int32 BuildRecursive(const int32 Start, const int32 End);
+	};
+}
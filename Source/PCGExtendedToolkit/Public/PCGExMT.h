@@ -120,6 +120,35 @@ namespace PCGExMT
 	class FTask;
 	class FTaskGroup;
 
+	/** Timings for a task group name, in cycles. Summed across every group sharing that name. */
+	struct PCGEXTENDEDTOOLKIT_API FGroupTelemetry
+	{
+		int32 NumGroups = 0;
+		int32 NumTasks = 0;
+		int32 NumScopes = 0;
+		uint64 WallCycles = 0;    // First launch to completion
+		uint64 BusyCycles = 0;    // Sum of task execution times
+		uint64 WaitCycles = 0;    // Sum of time tasks spent queued before a worker picked them up
+		uint64 MaxTaskCycles = 0; // Longest single task, compare against Busy / NumTasks to spot imbalanced chunking
+
+		void Append(const FGroupTelemetry& Other);
+	};
+
+	/** Per-context aggregate of task group timings, see UPCGExGlobalSettings::bTaskGroupTelemetry */
+	class PCGEXTENDEDTOOLKIT_API FTelemetry : public TSharedFromThis<FTelemetry>
+	{
+		mutable FRWLock TelemetryLock;
+		TMap<FName, FGroupTelemetry> Groups;
+
+	public:
+		FTelemetry() = default;
+
+		void Append(const FName InGroupName, const FGroupTelemetry& InTelemetry);
+
+		/** Logs one line per group name, slowest first */
+		void Log(const FString& InOwner) const;
+	};
+
 	class PCGEXTENDEDTOOLKIT_API FAsyncHandle : public TSharedFromThis<FAsyncHandle>
 	{
 	protected:
@@ -172,6 +201,8 @@ namespace PCGExMT
 
 		virtual bool IsAvailable() const;
 
+		void RecordTask(const uint64 InWaitCycles, const uint64 InBusyCycles);
+
 		template <typename T>
 		void Launch(const TSharedPtr<T>& InTask)
 		{
@@ -193,6 +224,18 @@ namespace PCGExMT
 
 		void SetExpectedTaskCount(const int32 InCount) { ExpectedTaskCount.store(InCount, std::memory_order_release); }
 
+		// Telemetry, inherited from root; everything below is left untouched when it's null
+		TSharedPtr<FTelemetry> Telemetry;
+		std::atomic<uint64> FirstLaunchCycles{0};
+		std::atomic<int32> TelemetryTaskCount{0};
+		std::atomic<uint64> TelemetryBusyCycles{0};
+		std::atomic<uint64> TelemetryWaitCycles{0};
+		std::atomic<uint64> TelemetryMaxTaskCycles{0};
+		int32 TelemetryScopeCount = 0;
+
+		void StampLaunch();
+		void FlushTelemetry();
+
 		virtual void HandleTaskStart();
 
 		virtual void StartBackgroundTask(const TSharedPtr<FTask>& InTask);
@@ -315,6 +358,7 @@ namespace PCGExMT
 			// Compute sub scopes
 			SetExpectedTaskCount(SubLoopScopes(Loops, MaxItems, FMath::Max(1, ChunkSize)));
 			StaticCastSharedPtr<FTaskManager>(PinnedRoot)->ReserveTasks(Loops.Num());
+			TelemetryScopeCount += Loops.Num();
 
 			if (OnPrepareSubLoopsCallback) { OnPrepareSubLoopsCallback(Loops); }
 
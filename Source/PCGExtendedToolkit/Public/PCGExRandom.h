@@ -40,6 +40,15 @@ namespace PCGExRandom
 		return ((A * 196314165U) + 907633515U) ^ ((B * 73148459U) + 453816763U) ^ ((C * 34731343U) + 453816743U);
 	}
 
+	/** Stateless 64-bit mix of a seed (splitmix64 finalizer); the same seed always yields the same bits, whatever the thread or call order. */
+	FORCEINLINE static uint64 HashSeed(const int32 Seed)
+	{
+		uint64 H = static_cast<uint64>(static_cast<uint32>(Seed)) + 0x9E3779B97F4A7C15ull;
+		H = (H ^ (H >> 30)) * 0xBF58476D1CE4E5B9ull;
+		H = (H ^ (H >> 27)) * 0x94D049BB133111EBull;
+		return H ^ (H >> 31);
+	}
+
 	PCGEXTENDEDTOOLKIT_API
 	int32 GetSeed(const int32 BaseSeed, const uint8 Flags, const int32 Local, const UPCGSettings* Settings = nullptr, const UPCGComponent* Component = nullptr);
 
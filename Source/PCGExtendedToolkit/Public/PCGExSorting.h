@@ -151,6 +151,26 @@ namespace PCGExSorting
 	PCGEXTENDEDTOOLKIT_API
 	void DeclareSortingRulesInputs(TArray<FPCGPinProperties>& PinProperties, const EPCGPinStatus InStatus);
 
+	/** Maps a double to an unsigned key that preserves ordering, suitable for radix sorting. -0 and +0 map to the same key. */
+	FORCEINLINE uint64 ToRadixKey(const double InValue)
+	{
+		const double Value = InValue + 0.0;
+		uint64 Bits;
+		FMemory::Memcpy(&Bits, &Value, sizeof(uint64));
+		return (Bits & 0x8000000000000000ull) ? ~Bits : Bits | 0x8000000000000000ull;
+	}
+
+	/**
+	 * Stable, parallel LSD radix sort of InOutOrder by Keys.
+	 * Keys are indexed by the values stored in InOutOrder, not by their position.
+	 */
+	PCGEXTENDEDTOOLKIT_API
+	void RadixSort(TArray<int32>& InOutOrder, const TArray<uint64>& Keys);
+
+	/** Stable, parallel merge sort of InOutOrder using the provided predicate. */
+	PCGEXTENDEDTOOLKIT_API
+	void ParallelMergeSort(TArray<int32>& InOutOrder, TFunctionRef<bool(const int32, const int32)> Predicate);
+
 	class PCGEXTENDEDTOOLKIT_API FRuleHandler : public TSharedFromThis<FRuleHandler>
 	{
 	public:
@@ -172,6 +192,16 @@ namespace PCGExSorting
 		double Tolerance = DBL_COMPARE_TOLERANCE;
 		bool bInvertRule = false;
 		bool bAbsolute = false;
+
+		// Materialized keys, see FPointSorter::BuildKeys
+		TArray<double> Keys;
+		TArray<TArray<double>> DataKeys;
+
+		// Quantize by tolerance and fold inversion & direction in, so keys can be compared with a plain <
+		FORCEINLINE double MakeKey(const double InValue, const double InSign) const
+		{
+			return (Tolerance > 0 ? FMath::FloorToDouble(InValue / Tolerance) : InValue) * InSign + 0.0;
+		}
 	};
 
 	class PCGEXTENDEDTOOLKIT_API FPointSorter : public TSharedFromThis<FPointSorter>
@@ -192,9 +222,48 @@ namespace PCGExSorting
 		bool Init(FPCGExContext* InContext, const TArray<TSharedRef<PCGExData::FFacade>>& InDataFacades);
 		bool Init(FPCGExContext* InContext, const TArray<FPCGTaggedData>& InTaggedDatas);
 
+		/**
+		 * Materialize each rule into a contiguous key column, once Init has been called.
+		 * Once built, Sort comparisons only read from the key columns.
+		 * Note that tolerance is applied by quantization, which is transitive but not strictly identical to a nearly-equal test.
+		 */
+		bool BuildKeys();
+		bool BuildKeys(const TArray<TSharedRef<PCGExData::FFacade>>& InDataFacades);
+		FORCEINLINE bool HasKeys() const { return bHasKeys; }
+		FORCEINLINE bool HasDataKeys() const { return bHasDataKeys; }
+
 		bool Sort(const int32 A, const int32 B);
 		bool Sort(const PCGExData::FElement A, const PCGExData::FElement B);
 		bool SortData(const int32 A, const int32 B);
+
+		/** Sort an array of point indices. Uses key columns & parallel sorting when available. */
+		void Sort(TArray<int32>& InOutOrder);
+
+	protected:
+		bool bHasKeys = false;     // Single facade layout, see RuleHandler->Keys
+		bool bHasDataKeys = false; // Multi-facade layout, see RuleHandler->DataKeys
+
+		FORCEINLINE bool SortKeys(const int32 A, const int32 B) const
+		{
+			for (const TSharedPtr<FRuleHandler>& RuleHandler : RuleHandlers)
+			{
+				const double KeyA = RuleHandler->Keys[A];
+				const double KeyB = RuleHandler->Keys[B];
+				if (KeyA != KeyB) { return KeyA < KeyB; }
+			}
+			return false;
+		}
+
+		FORCEINLINE bool SortKeys(const PCGExData::FElement A, const PCGExData::FElement B) const
+		{
+			for (const TSharedPtr<FRuleHandler>& RuleHandler : RuleHandlers)
+			{
+				const double KeyA = RuleHandler->DataKeys[A.IO][A.Index];
+				const double KeyB = RuleHandler->DataKeys[B.IO][B.Index];
+				if (KeyA != KeyB) { return KeyA < KeyB; }
+			}
+			return false;
+		}
 	};
 
 	PCGEXTENDEDTOOLKIT_API
@@ -155,8 +155,12 @@ protected:
 
 namespace PCGExPathCrossings
 {
+	class FBatch;
+
 	class FProcessor final : public PCGExPointsMT::TProcessor<FPCGExPathCrossingsContext, UPCGExPathCrossingsSettings>
 	{
+		friend class FBatch;
+
 		bool bClosedLoop = false;
 		bool bSelfIntersectionOnly = false;
 		bool bCanCut = true;
@@ -208,4 +212,24 @@ namespace PCGExPathCrossings
 
 		virtual void Write() override;
 	};
+
+	class FBatch final : public PCGExPointsMT::TBatch<FProcessor>
+	{
+		// Indexed like processors, null for paths that can't cut
+		TArray<TSharedPtr<PCGExPaths::FPath>> CutterPaths;
+		PCGExPaths::FPathEdgeBVH CutterBVH;
+
+	public:
+		explicit FBatch(FPCGExContext* InContext, const TArray<TWeakPtr<PCGExData::FPointIO>>& InPointsCollection):
+			TBatch(InContext, InPointsCollection)
+		{
+		}
+
+		const PCGExPaths::FPathEdgeBVH& GetCutterBVH() const { return CutterBVH; }
+		const TSharedPtr<PCGExPaths::FPath>& GetCutterPath(const int32 Index) const { return CutterPaths[Index]; }
+
+		virtual void CompleteWork() override;
+		void BuildCutterBVH();
+		void OnCutterBVHBuilt();
+	};
 }
@@ -660,6 +660,92 @@ namespace PCGExPaths
 		PCGExMath::FClosestPosition& OutClosestPosition,
 		const PCGExMath::EIntersectionTestMode Mode = PCGExMath::EIntersectionTestMode::Strict);
 
+	/**
+	 * Horizontal slab decomposition of a closed 2D polygon.
+	 * Each slab references the edges overlapping its Y range, so a point-in-polygon test only
+	 * walks the handful of edges that can cross a +X ray from the point instead of the whole polygon.
+	 * Inclusion uses the non-zero winding rule, same as FGeomTools2D::IsPointInPolygon.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FPolygonSlabs
+	{
+		double MinY = 0;
+		double InvSlabHeight = 0;
+		int32 NumSlabs = 0;
+
+		TArray<int32> SlabStarts; // NumSlabs + 1 offsets into SlabEdges
+		TArray<int32> SlabEdges;  // Edge i goes from point i to point i + 1 (wrapping)
+
+	public:
+		static constexpr int32 MinPoints = 32;
+		static constexpr int32 MaxSlabs = 4096;
+
+		FPolygonSlabs() = default;
+		explicit FPolygonSlabs(const TArray<FVector2D>& InPoints);
+
+		FORCEINLINE bool IsValid() const { return NumSlabs > 0; }
+
+		bool IsInside(const FVector2D& InPoint, const TArray<FVector2D>& InPoints) const;
+
+	protected:
+		FORCEINLINE int32 GetSlab(const double Y) const { return FMath::Clamp(FMath::FloorToInt32((Y - MinY) * InvSlabHeight), 0, NumSlabs - 1); }
+	};
+
+	/**
+	 * Bounding volume hierarchy over the segments of a spline, built in spline-local space.
+	 * Each segment is cut into a few spans bounded by the hull of their Bezier control points, which always contains the curve.
+	 * Closest-key queries only run the exact per-segment refinement (FInterpCurve::FindNearestOnSegment) on segments whose
+	 * bounds can still beat the best candidate, and return the same key as FPCGSplineStruct::FindInputKeyClosestToWorldLocation.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FSplineSegmentTree
+	{
+	public:
+		struct FSpan
+		{
+			FBox Bounds = FBox(ForceInit);
+			int32 Segment = -1;
+		};
+
+		struct FNode
+		{
+			FBox Bounds = FBox(ForceInit);
+			int32 Start = 0; // First span in Spans
+			int32 End = 0;   // One past last span in Spans
+			int32 Left = -1;
+			int32 Right = -1;
+
+			FORCEINLINE bool IsLeaf() const { return Left == -1; }
+		};
+
+		static constexpr int32 MinSegments = 8;
+		static constexpr int32 SpansPerCurveSegment = 4;
+		static constexpr int32 MaxSpansPerLeaf = 4;
+
+	protected:
+		const FPCGSplineStruct* Spline = nullptr;
+		TArray<FNode> Nodes;
+		TArray<FSpan> Spans;
+
+	public:
+		FSplineSegmentTree() = default;
+		explicit FSplineSegmentTree(const FPCGSplineStruct& InSpline);
+
+		FORCEINLINE bool IsValid() const { return !Nodes.IsEmpty(); }
+
+		/** Conservative world-space bounds of the whole spline. Degenerate for single point splines, invalid for empty ones. */
+		FBox GetWorldBounds() const;
+
+		/**
+		 * Closest input key to a world location.
+		 * Segments that are provably farther than MaxDistance are culled; returns false if no segment survives.
+		 * A returned key may still lie slightly beyond MaxDistance, callers are expected to test the sampled distance.
+		 */
+		bool FindInputKeyClosestToWorldLocation(const FVector& WorldLocation, float& OutKey, const double MaxDistance = MAX_dbl) const;
+		float FindInputKeyClosestToWorldLocation(const FVector& WorldLocation) const;
+
+	protected:
+		int32 BuildRecursive(const int32 Start, const int32 End);
+	};
+
 	class FPolyPath : public FPath
 	{
 		TSharedPtr<FPCGSplineStruct> LocalSpline;
@@ -668,6 +754,8 @@ namespace PCGExPaths
 
 		const FPCGSplineStruct* Spline = nullptr;
 		TArray<FVector2D> ProjectedPoints;
+		FPolygonSlabs Slabs;
+		FSplineSegmentTree SegmentTree;
 		FPCGExGeo2DProjectionDetails Projection;
 		FBox PolyBox = FBox(ForceInit);
 
@@ -697,6 +785,8 @@ namespace PCGExPaths
 			const TConstPCGValueRange<FTransform>& InTransforms,
 			const double ExpansionZ = -1, const EPCGExWindingMutation WindingMutation = EPCGExWindingMutation::Unchanged);
 
+		float FindClosestKey(const FVector& WorldPosition) const;
+
 	public:
 		virtual bool IsInsideProjection(const FVector& WorldPosition) const override;
 
@@ -712,6 +802,80 @@ namespace PCGExPaths
 		virtual int32 GetClosestEdge(const double InTime, float& OutLerp) const override;
 	};
 
+	/**
+	 * Static, flat bounding volume hierarchy over the edges of any number of paths.
+	 * Built once, then queried concurrently; a single traversal replaces one edge octree query per path.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FPathEdgeBVH
+	{
+	public:
+		struct FItem
+		{
+			FBox Bounds = FBox(ForceInit);
+			int32 Path = -1; // Index in the paths array the tree was built from
+			int32 Edge = -1; // Edge index in that path
+		};
+
+		struct FNode
+		{
+			FBox Bounds = FBox(ForceInit);
+			int32 Start = 0; // First item in Items
+			int32 End = 0;   // One past last item in Items
+			int32 Left = -1;
+			int32 Right = -1;
+
+			FORCEINLINE bool IsLeaf() const { return Left == -1; }
+		};
+
+		static constexpr int32 MaxItemsPerLeaf = 4;
+
+	protected:
+		TArray<FNode> Nodes;
+		TArray<FItem> Items;
+
+	public:
+		FPathEdgeBVH() = default;
+
+		/**
+		 * Gathers, in parallel, every valid edge for which Filter(PathIndex, EdgeIndex) returns true.
+		 * Null paths are skipped.
+		 */
+		void Build(const TArray<TSharedPtr<FPath>>& InPaths, const TFunctionRef<bool(const int32, const int32)>& Filter);
+		void Reset();
+
+		FORCEINLINE int32 Num() const { return Items.Num(); }
+		FORCEINLINE bool IsEmpty() const { return Items.IsEmpty(); }
+
+		/** Calls Callback(const FItem&) for every item whose bounds intersect InBox */
+		template <typename Func>
+		void FindOverlaps(const FBox& InBox, Func&& Callback) const
+		{
+			if (Nodes.IsEmpty()) { return; }
+
+			int32 Stack[64];
+			int32 StackSize = 0;
+			Stack[StackSize++] = 0;
+
+			while (StackSize)
+			{
+				const FNode& Node = Nodes[Stack[--StackSize]];
+				if (!Node.Bounds.Intersect(InBox)) { continue; }
+
+				if (Node.IsLeaf())
+				{
+					for (int32 i = Node.Start; i < Node.End; i++) { if (Items[i].Bounds.Intersect(InBox)) { Callback(Items[i]); } }
+					continue;
+				}
+
+				Stack[StackSize++] = Node.Right;
+				Stack[StackSize++] = Node.Left;
+			}
+		}
+
+	protected:
+		int32 BuildRecursive(const int32 Start, const int32 End);
+	};
+
 	struct PCGEXTENDEDTOOLKIT_API FCrossing
 	{
 		FCrossing() = default;
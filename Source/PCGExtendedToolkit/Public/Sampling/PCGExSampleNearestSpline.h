@@ -13,6 +13,7 @@
 #include "PCGExSampling.h"
 #include "PCGExScopedContainers.h"
 #include "Data/PCGSplineData.h"
+#include "Paths/PCGExPaths.h"
 
 
 #include "Misc/PCGExSortPoints.h"
@@ -446,6 +447,7 @@ struct FPCGExSampleNearestSplineContext final : FPCGExPointsProcessorContext
 
 	TArray<const UPCGSplineData*> Targets;
 	TArray<FPCGSplineStruct> Splines;
+	TArray<PCGExPaths::FSplineSegmentTree> SegmentTrees;
 	TArray<double> SegmentCounts;
 	TArray<double> Lengths;
 
@@ -503,6 +505,7 @@ namespace PCGExSampleNearestSpline
 		bool bClosestSample = false;
 		bool bOnlySignIfClosed = false;
 		bool bOnlyIncrementInsideNumIfClosed = false;
+		bool bCullOutOfRange = false;
 
 		PCGEX_FOREACH_FIELD_NEARESTPOLYLINE(PCGEX_OUTPUT_DECL)
 
@@ -5,6 +5,7 @@
 
 #include "PCGEx.h"
 #include "PCGExOctree.h"
+#include "PCGExKDTree.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGExDataPreloader.h"
 #include "Data/PCGExUnionData.h"
@@ -204,6 +205,9 @@ namespace PCGExSampling
 		int32 MaxNumTargets = 0;
 
 		TSharedPtr<PCGExDetails::FDistances> Distances;
+		bool bCenterDistances = false;
+
+		TSharedPtr<PCGExKDTree::FPointKDTree> TargetsKDTree;
 
 	public:
 		using FInitData = std::function<FBox(const TSharedPtr<PCGExData::FPointIO>&, const int32)>;
@@ -255,6 +259,18 @@ namespace PCGExSampling
 		FORCEINLINE PCGExData::FConstPoint GetPoint(const int32 IO, const int32 Index) const { return TargetFacades[IO]->GetInPoint(Index); }
 		FORCEINLINE PCGExData::FConstPoint GetPoint(const PCGExData::FPoint& Point) const { return TargetFacades[Point.IO]->GetInPoint(Point.Index); }
 
+		/**
+		 * Build a static k-d tree over every target point, for unbounded nearest/farthest queries.
+		 * Results are only exact for center-to-center distances, so this is a no-op otherwise.
+		 * Must be called after SetDistances, and before any of the KD queries below.
+		 */
+		bool BuildKDTree();
+		bool HasKDTree() const { return TargetsKDTree.IsValid(); }
+
+		bool FindNearestTarget(const FVector& Probe, PCGExData::FConstPoint& OutResult, double& OutDistSquared, const TSet<const UPCGData*>* Exclude = nullptr) const;
+		bool FindFarthestTarget(const FVector& Probe, PCGExData::FConstPoint& OutResult, double& OutDistSquared, const TSet<const UPCGData*>* Exclude = nullptr) const;
+		void FindKNearestTargets(const FVector& Probe, const int32 K, TArray<PCGExData::FElement>& OutResults, TArray<double>& OutDistSquared, const TSet<const UPCGData*>* Exclude = nullptr) const;
+
 		double GetDistSquared(const PCGExData::FConstPoint& SourcePoint, const PCGExData::FConstPoint& TargetPoint) const;
 		FORCEINLINE FVector GetSourceCenter(const PCGExData::FConstPoint& OriginPoint, const FVector& OriginLocation, const FVector& ToCenter) const { return Distances->GetSourceCenter(OriginPoint, OriginLocation, ToCenter); }
 
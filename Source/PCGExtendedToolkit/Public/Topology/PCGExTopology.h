@@ -392,6 +392,34 @@ namespace PCGExTopology
 		bool Overlaps(const FGeometryScriptSimplePolygon& Polygon);
 	};
 
+	/**
+	 * Planar half-edge (DCEL) view of a cluster, built once from projected positions.
+	 * Half-edge 2*E leaves edge E's start node, 2*E+1 leaves its end node; twins are H ^ 1.
+	 * Every half-edge borders exactly one face, so faces can be enumerated once, without de-duplication.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FHalfEdgeGraph : public TSharedFromThis<FHalfEdgeGraph>
+	{
+	public:
+		TArray<int32> Origin; // Node each half-edge leaves from
+		TArray<int32> Next;   // Next half-edge around the same face
+		TArray<int32> Face;   // Face each half-edge borders
+		TArray<int32> Faces;  // Lowest half-edge of each face
+
+		FHalfEdgeGraph() = default;
+
+		void Build(const TSharedRef<PCGExCluster::FCluster>& InCluster, const TArray<FVector2D>& ProjectedPositions);
+
+		FORCEINLINE int32 Num() const { return Origin.Num(); }
+		FORCEINLINE int32 NumFaces() const { return Faces.Num(); }
+
+		FORCEINLINE static int32 GetEdge(const int32 HalfEdge) { return HalfEdge >> 1; }
+		FORCEINLINE static int32 GetTwin(const int32 HalfEdge) { return HalfEdge ^ 1; }
+		FORCEINLINE int32 GetDestination(const int32 HalfEdge) const { return Origin[HalfEdge ^ 1]; }
+
+		/** Half-edge leaving InLink.Node through InLink.Edge, or -1 */
+		int32 FindHalfEdge(const PCGExGraph::FLink InLink) const;
+	};
+
 	class FCellConstraints : public TSharedFromThis<FCellConstraints>
 	{
 	protected:
@@ -531,10 +559,25 @@ namespace PCGExTopology
 			const TArray<FVector2D>& ProjectedPositions,
 			const FPCGExNodeSelectionDetails* Picking = nullptr);
 
+		/** Builds the cell bordering InFace. Faces are unique by construction, so no de-duplication happens here. */
+		ECellResult BuildFromFace(
+			const FHalfEdgeGraph& InHalfEdges,
+			const int32 InFace,
+			const TSharedRef<PCGExCluster::FCluster>& InCluster,
+			const TArray<FVector2D>& ProjectedPositions);
+
 		ECellResult BuildFromPath(
 			const TArray<FVector2D>& ProjectedPositions);
 
 		void PostProcessPoints(UPCGBasePointData* InMutablePoints);
+
+	protected:
+		ECellResult CompleteBuild(
+			const TSharedRef<PCGExCluster::FCluster>& InCluster,
+			const TArray<FVector2D>& ProjectedPositions,
+			const PCGExPaths::FPathMetrics& Metrics,
+			const int32 NumUniqueNodes,
+			const bool bDeduplicate);
 	};
 
 #pragma endregion
@@ -0,0 +1,52 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGExTensor.h"
+
+namespace PCGExTensor
+{
+	/**
+	 * Sparse, lazily-baked cache of a combined tensor field.
+	 * Space is split into bricks of BrickCells^3 cells; a brick is baked the first time a sample lands in it,
+	 * then queries are answered with a trilinear interpolation of the brick corner samples.
+	 * Bricks are baked outside of the lock so concurrent samplers bake different bricks in parallel.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FBakedField : public TSharedFromThis<FBakedField>
+	{
+	public:
+		static constexpr int32 BrickCells = 8;
+		static constexpr int32 BrickSamples = BrickCells + 1;
+
+		using FEvaluateFunc = TFunctionRef<FTensorSample(const FVector&)>;
+
+	protected:
+		struct FBrick
+		{
+			TArray<FTensorSample> Samples; // BrickSamples^3 corner samples, X-major
+		};
+
+		double CellSize = 50;
+		double InvCellSize = 1.0 / 50;
+		int32 MaxBricks = 1024;
+
+		mutable FRWLock BricksLock;
+		mutable TMap<FIntVector, TSharedPtr<FBrick>> Bricks;
+		mutable std::atomic<int32> NumBricks{0};
+
+	public:
+		FBakedField(const double InCellSize, const int32 InMaxBricks);
+
+		/**
+		 * Interpolated sample at the given position.
+		 * @return false if the position could not be answered from the cache, either because the brick budget is exhausted
+		 * or because one of the surrounding corners lies outside of any tensor influence. Callers should sample analytically then.
+		 */
+		bool Sample(const FVector& InPosition, FTensorSample& OutSample, FEvaluateFunc&& Evaluate) const;
+
+	protected:
+		const FBrick* GetOrBakeBrick(const FIntVector& InKey, FEvaluateFunc& Evaluate) const;
+	};
+}
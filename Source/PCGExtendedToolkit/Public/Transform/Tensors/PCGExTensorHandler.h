@@ -78,6 +78,19 @@ struct PCGEXTENDEDTOOLKIT_API FPCGExTensorHandlerDetails
 	/** Uniform scale factor applied to sampling after all other mutations are accounted for. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
 	FPCGExTensorSamplerDetails SamplerSettings;
+
+	/** If enabled, the combined field is lazily baked into a sparse grid and sampled with trilinear interpolation.
+	 * Trades accuracy for speed when sampling the same area many times. Ignored if any tensor depends on the probe orientation (Inertia, bidirectional mutations). */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Baking", meta = (PCG_Overridable))
+	bool bBakeField = false;
+
+	/** Size of a baked cell. Smaller cells are more accurate but take longer to bake. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Baking", meta = (PCG_Overridable, DisplayName=" ├─ Cell Size", EditCondition="bBakeField", ClampMin=1))
+	double BakeCellSize = 50;
+
+	/** Maximum number of baked bricks (8x8x8 cells each). Samples beyond that budget fall back to analytic sampling. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Baking", meta = (PCG_Overridable, DisplayName=" └─ Max Bricks", EditCondition="bBakeField", ClampMin=1))
+	int32 MaxBakedBricks = 1024;
 };
 
 namespace PCGExTensor
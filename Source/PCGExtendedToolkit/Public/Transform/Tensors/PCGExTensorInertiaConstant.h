@@ -46,6 +46,9 @@ public:
 	virtual bool Init(FPCGExContext* InContext, const UPCGExTensorFactoryData* InFactory) override;
 
 	virtual PCGExTensor::FTensorSample Sample(int32 InSeedIndex, const FTransform& InProbe) const override;
+
+	// Depends on seed & probe orientation
+	virtual bool IsBakeable() const override { return false; }
 };
 
 
@@ -27,6 +27,9 @@ public:
 
 	virtual bool PrepareForData(const TSharedPtr<PCGExData::FFacade>& InDataFacade);
 
+	/** Whether this tensor only depends on the probe location, and can therefore be baked into a FBakedField. */
+	virtual bool IsBakeable() const { return !BaseConfig.Mutations.bBidirectional; }
+
 	template <bool bFast = false>
 	bool ComputeFactor(const FVector& InPosition, const int32 InEffectorIndex, PCGExTensor::FEffectorMetrics& OutMetrics) const
 	{
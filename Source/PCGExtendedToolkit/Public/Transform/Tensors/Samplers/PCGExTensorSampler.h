@@ -9,6 +9,7 @@
 
 #include "Transform/Tensors/PCGExTensor.h"
 #include "Transform/Tensors/PCGExTensorOperation.h"
+#include "Transform/Tensors/PCGExTensorBakedField.h"
 
 #include "PCGExTensorSampler.generated.h"
 
@@ -24,8 +25,14 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
 	double Radius = 1;
 
+	/** Optional baked field; when set, raw samples are interpolated from it whenever possible. */
+	TSharedPtr<PCGExTensor::FBakedField> BakedField;
+
 	virtual void CopySettingsFrom(const UPCGExInstancedFactory* Other) override;
 	virtual bool PrepareForData(FPCGExContext* InContext);
 	virtual PCGExTensor::FTensorSample RawSample(const TArray<TSharedPtr<PCGExTensorOperation>>& InTensors, int32 InSeedIndex, const FTransform& InProbe) const;
 	virtual PCGExTensor::FTensorSample Sample(const TArray<TSharedPtr<PCGExTensorOperation>>& InTensors, int32 InSeedIndex, const FTransform& InProbe, bool& OutSuccess) const;
+
+protected:
+	PCGExTensor::FTensorSample AnalyticSample(const TArray<TSharedPtr<PCGExTensorOperation>>& InTensors, int32 InSeedIndex, const FTransform& InProbe) const;
 };
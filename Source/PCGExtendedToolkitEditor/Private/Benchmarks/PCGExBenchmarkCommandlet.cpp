@@ -0,0 +1,577 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Benchmarks/PCGExBenchmarkCommandlet.h"
+
+#include "PCGExH.h"
+#include "PCGExContext.h"
+#include "PCGExGlobalSettings.h"
+#include "PCGExKDTree.h"
+#include "PCGExSorting.h"
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Data/PCGExData.h"
+#include "Data/PCGExPointIO.h"
+#include "Data/PCGPointArrayData.h"
+#include "Geometry/PCGExGeo.h"
+#include "Geometry/PCGExGeoDelaunay.h"
+#include "Graph/PCGExCluster.h"
+#include "Graph/PCGExGraph.h"
+#include "Graph/PCGExIntersections.h"
+#include "Graph/Pathfinding/PCGExPathfinding.h"
+#include "Graph/Pathfinding/Heuristics/PCGExHeuristicDistance.h"
+#include "Graph/Pathfinding/Heuristics/PCGExHeuristics.h"
+#include "Graph/Pathfinding/Search/PCGExSearchAStar.h"
+#include "Graph/Pathfinding/Search/PCGExSearchBidirectionalAStar.h"
+#include "Graph/Pathfinding/Search/PCGExSearchDijkstra.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogPCGExBenchmark, Log, All);
+
+namespace PCGExBenchmark
+{
+	namespace Generators
+	{
+		void Grid(const int32 NumPoints, const double Spacing, TArray<FVector>& OutPositions)
+		{
+			const int32 Side = FMath::Max(1, FMath::CeilToInt32(FMath::Sqrt(static_cast<double>(NumPoints))));
+
+			OutPositions.Reset(NumPoints);
+			for (int32 i = 0; i < NumPoints; i++) { OutPositions.Emplace((i % Side) * Spacing, (i / Side) * Spacing, 0); }
+		}
+
+		void PoissonCloud(const int32 NumPoints, const double Radius, const int32 Seed, TArray<FVector>& OutPositions)
+		{
+			OutPositions.Reset(NumPoints);
+			if (NumPoints <= 0) { return; }
+
+			constexpr int32 MaxAttempts = 30;
+
+			// Domain sized so ~NumPoints disks fit at the usual Bridson packing density
+			const double Extent = Radius * FMath::Sqrt(static_cast<double>(NumPoints)) * 1.25;
+			const double CellSize = Radius / UE_SQRT_2;
+			const int32 GridSide = FMath::Max(1, FMath::CeilToInt32(Extent / CellSize));
+			const double RadiusSquared = Radius * Radius;
+
+			TArray<int32> Cells;
+			Cells.Init(-1, GridSide * GridSide);
+
+			auto CellOf = [&](const FVector& P) { return FIntPoint(FMath::Clamp(FMath::FloorToInt32(P.X / CellSize), 0, GridSide - 1), FMath::Clamp(FMath::FloorToInt32(P.Y / CellSize), 0, GridSide - 1)); };
+
+			auto IsFree = [&](const FVector& P)
+			{
+				if (P.X < 0 || P.Y < 0 || P.X >= Extent || P.Y >= Extent) { return false; }
+
+				const FIntPoint C = CellOf(P);
+				for (int32 y = FMath::Max(0, C.Y - 2); y <= FMath::Min(GridSide - 1, C.Y + 2); y++)
+				{
+					for (int32 x = FMath::Max(0, C.X - 2); x <= FMath::Min(GridSide - 1, C.X + 2); x++)
+					{
+						const int32 Other = Cells[y * GridSide + x];
+						if (Other != -1 && FVector::DistSquared(P, OutPositions[Other]) < RadiusSquared) { return false; }
+					}
+				}
+
+				return true;
+			};
+
+			auto Accept = [&](const FVector& P)
+			{
+				const FIntPoint C = CellOf(P);
+				const int32 Index = OutPositions.Add(P);
+				Cells[C.Y * GridSide + C.X] = Index;
+				return Index;
+			};
+
+			FRandomStream Random(Seed);
+			TArray<int32> Active;
+			Active.Add(Accept(FVector(Random.FRand() * Extent, Random.FRand() * Extent, 0)));
+
+			while (!Active.IsEmpty() && OutPositions.Num() < NumPoints)
+			{
+				const int32 ActiveIndex = Random.RandHelper(Active.Num());
+				const FVector Origin = OutPositions[Active[ActiveIndex]];
+
+				bool bFound = false;
+				for (int32 a = 0; a < MaxAttempts; a++)
+				{
+					const double Angle = Random.FRand() * UE_TWO_PI;
+					const double Dist = Radius * (1 + Random.FRand());
+					const FVector Candidate = Origin + FVector(FMath::Cos(Angle) * Dist, FMath::Sin(Angle) * Dist, 0);
+
+					if (!IsFree(Candidate)) { continue; }
+
+					Active.Add(Accept(Candidate));
+					bFound = true;
+					break;
+				}
+
+				if (!bFound) { Active.RemoveAtSwap(ActiveIndex, 1, EAllowShrinking::No); }
+			}
+		}
+
+		void UniformCloud(const int32 NumPoints, const double Extent, const int32 Seed, TArray<FVector>& OutPositions)
+		{
+			FRandomStream Random(Seed);
+
+			OutPositions.Reset(NumPoints);
+			for (int32 i = 0; i < NumPoints; i++)
+			{
+				// Sequenced draws, argument evaluation order is unspecified
+				const double X = Random.FRandRange(-Extent, Extent);
+				const double Y = Random.FRandRange(-Extent, Extent);
+				const double Z = Random.FRandRange(-Extent, Extent);
+				OutPositions.Emplace(X, Y, Z);
+			}
+		}
+
+		void PlanarGraph(const int32 NumPoints, const double DropRatio, const int32 Seed, TArray<FVector>& OutPositions, TArray<uint64>& OutEdges)
+		{
+			OutEdges.Reset();
+			PoissonCloud(NumPoints, 100, Seed, OutPositions);
+
+			const TUniquePtr<PCGExGeo::TDelaunay2> Delaunay = MakeUnique<PCGExGeo::TDelaunay2>();
+			if (!Delaunay->Process(OutPositions, FPCGExGeo2DProjectionDetails())) { return; }
+
+			// TSet iteration order depends on insertion only, but sort anyway so the drop pattern is stable across engine versions
+			OutEdges = Delaunay->DelaunayEdges.Array();
+			OutEdges.Sort();
+
+			FRandomStream Random(Seed + 1);
+			OutEdges.RemoveAll([&](const uint64) { return Random.FRand() < DropRatio; });
+		}
+
+		void GridGraph(const int32 NumPoints, TArray<uint64>& OutEdges)
+		{
+			const int32 Side = FMath::Max(1, FMath::CeilToInt32(FMath::Sqrt(static_cast<double>(NumPoints))));
+
+			OutEdges.Reset(NumPoints * 2);
+			for (int32 i = 0; i < NumPoints; i++)
+			{
+				if ((i % Side) + 1 < Side && i + 1 < NumPoints) { OutEdges.Add(PCGEx::H64U(i, i + 1)); }
+				if (i + Side < NumPoints) { OutEdges.Add(PCGEx::H64U(i, i + Side)); }
+			}
+		}
+	}
+
+	/** Transient point data holding the given positions, owned by the context managed objects. */
+	static UPCGBasePointData* MakePointData(FPCGExContext* InContext, const TArray<FVector>& InPositions)
+	{
+		UPCGBasePointData* PointData = InContext->ManagedObjects->New<UPCGPointArrayData>();
+		PCGEx::SetNumPointsAllocated(PointData, InPositions.Num(), EPCGPointNativeProperties::Transform);
+
+		TPCGValueRange<FTransform> Transforms = PointData->GetTransformValueRange(false);
+		for (int32 i = 0; i < InPositions.Num(); i++) { Transforms[i] = FTransform(InPositions[i]); }
+
+		return PointData;
+	}
+}
+
+UPCGExBenchmarkCommandlet::UPCGExBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UPCGExBenchmarkCommandlet::Main(const FString& Params)
+{
+	FString SizesStr = TEXT("1000,10000,100000");
+	FParse::Value(*Params, TEXT("Sizes="), SizesStr);
+	FParse::Value(*Params, TEXT("Iterations="), Iterations);
+	FParse::Value(*Params, TEXT("Seed="), Seed);
+	FParse::Value(*Params, TEXT("Filter="), Filter);
+
+	FString OutputPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("PCGEx"), TEXT("Benchmarks"), FString::Printf(TEXT("PCGExBenchmark-%s.csv"), *FDateTime::UtcNow().ToString()));
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+	Iterations = FMath::Max(1, Iterations);
+
+	TArray<FString> SizeTokens;
+	SizesStr.ParseIntoArray(SizeTokens, TEXT(","));
+	for (const FString& Token : SizeTokens)
+	{
+		const int32 Size = FCString::Atoi(*Token);
+		if (Size > 0) { Sizes.Add(Size); }
+	}
+
+	if (Sizes.IsEmpty())
+	{
+		UE_LOG(LogPCGExBenchmark, Error, TEXT("No valid -Sizes provided."));
+		return 1;
+	}
+
+	for (const int32 Size : Sizes)
+	{
+		RunDelaunay(Size);
+		RunGraph(Size);
+		RunKDTree(Size);
+		RunUnionGraph(Size);
+		RunSorter(Size);
+		RunPathfinding(Size);
+	}
+
+	if (!WriteResults(OutputPath))
+	{
+		UE_LOG(LogPCGExBenchmark, Error, TEXT("Could not write results to %s"), *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogPCGExBenchmark, Display, TEXT("%d results written to %s"), Results.Num(), *OutputPath);
+	return 0;
+}
+
+void UPCGExBenchmarkCommandlet::Measure(const FString& InKernel, const FString& InDataset, const int32 InSize, TFunctionRef<int64()> Kernel)
+{
+	if (!Filter.IsEmpty() && !InKernel.Contains(Filter)) { return; }
+
+	PCGExBenchmark::FResult& Result = Results.Emplace_GetRef();
+	Result.Kernel = InKernel;
+	Result.Dataset = InDataset;
+	Result.Size = InSize;
+	Result.Iterations = Iterations;
+
+	// Warmup, also gives us the checksum
+	Result.Checksum = Kernel();
+
+	TArray<double> Timings;
+	Timings.Reserve(Iterations);
+
+	for (int32 i = 0; i < Iterations; i++)
+	{
+		const double Start = FPlatformTime::Seconds();
+		const int64 Checksum = Kernel();
+		Timings.Add((FPlatformTime::Seconds() - Start) * 1000);
+
+		if (Checksum != Result.Checksum) { UE_LOG(LogPCGExBenchmark, Warning, TEXT("%s/%s/%d : non-deterministic output (%lld vs %lld)"), *InKernel, *InDataset, InSize, Checksum, Result.Checksum); }
+	}
+
+	Timings.Sort();
+
+	double Sum = 0;
+	for (const double T : Timings) { Sum += T; }
+
+	Result.MinMs = Timings[0];
+	Result.MedianMs = Timings[Timings.Num() / 2];
+	Result.MeanMs = Sum / Timings.Num();
+
+	UE_LOG(LogPCGExBenchmark, Display, TEXT("%-24s %-10s %8d : min %9.3fms | median %9.3fms | mean %9.3fms"), *InKernel, *InDataset, InSize, Result.MinMs, Result.MedianMs, Result.MeanMs);
+}
+
+void UPCGExBenchmarkCommandlet::RunDelaunay(const int32 InSize)
+{
+	TArray<FVector> Poisson;
+	PCGExBenchmark::Generators::PoissonCloud(InSize, 100, Seed, Poisson);
+
+	TArray<FVector> Uniform;
+	PCGExBenchmark::Generators::UniformCloud(InSize, 10000, Seed, Uniform);
+
+	const FPCGExGeo2DProjectionDetails Projection;
+
+	Measure(
+		TEXT("Delaunay2"), TEXT("Poisson"), Poisson.Num(), [&]()
+		{
+			const TUniquePtr<PCGExGeo::TDelaunay2> Delaunay = MakeUnique<PCGExGeo::TDelaunay2>();
+			if (!Delaunay->Process(Poisson, Projection)) { return static_cast<int64>(-1); }
+			return static_cast<int64>(Delaunay->DelaunayEdges.Num());
+		});
+
+	Measure(
+		TEXT("Delaunay3"), TEXT("Uniform"), Uniform.Num(), [&]()
+		{
+			const TUniquePtr<PCGExGeo::TDelaunay3> Delaunay = MakeUnique<PCGExGeo::TDelaunay3>();
+			if (!Delaunay->Process<false, false>(Uniform)) { return static_cast<int64>(-1); }
+			return static_cast<int64>(Delaunay->DelaunayEdges.Num());
+		});
+}
+
+void UPCGExBenchmarkCommandlet::RunGraph(const int32 InSize)
+{
+	const FPCGExGraphBuilderDetails Limits;
+
+	auto BuildGraph = [&](const int32 NumNodes, const TArray<uint64>& Edges)
+	{
+		const TSharedPtr<PCGExGraph::FGraph> Graph = MakeShared<PCGExGraph::FGraph>(NumNodes);
+		Graph->InsertEdges(Edges, -1);
+		Graph->BuildSubGraphs(Limits);
+
+		// Component count and edge count together catch both insertion and partitioning changes
+		return static_cast<int64>(Graph->SubGraphs.Num()) << 32 | Graph->Edges.Num();
+	};
+
+	TArray<FVector> PlanarPositions;
+	TArray<uint64> PlanarEdges;
+	PCGExBenchmark::Generators::PlanarGraph(InSize, 0.35, Seed, PlanarPositions, PlanarEdges);
+
+	TArray<uint64> GridEdges;
+	PCGExBenchmark::Generators::GridGraph(InSize, GridEdges);
+
+	Measure(TEXT("Graph.BuildSubGraphs"), TEXT("Planar"), PlanarPositions.Num(), [&]() { return BuildGraph(PlanarPositions.Num(), PlanarEdges); });
+	Measure(TEXT("Graph.BuildSubGraphs"), TEXT("Grid"), InSize, [&]() { return BuildGraph(InSize, GridEdges); });
+}
+
+void UPCGExBenchmarkCommandlet::RunKDTree(const int32 InSize)
+{
+	TArray<FVector> Positions;
+	PCGExBenchmark::Generators::UniformCloud(InSize, 10000, Seed, Positions);
+
+	TArray<FVector> Probes;
+	PCGExBenchmark::Generators::UniformCloud(InSize, 10000, Seed + 1, Probes);
+
+	auto MakeItems = [&]()
+	{
+		TArray<PCGExKDTree::FItem> Items;
+		Items.Reserve(Positions.Num());
+		for (int32 i = 0; i < Positions.Num(); i++) { Items.Emplace(Positions[i], 0, i); }
+		return Items;
+	};
+
+	Measure(
+		TEXT("KDTree.Build"), TEXT("Uniform"), InSize, [&]()
+		{
+			const PCGExKDTree::FPointKDTree Tree(MakeItems());
+			return static_cast<int64>(Tree.Num());
+		});
+
+	const PCGExKDTree::FPointKDTree Tree(MakeItems());
+
+	Measure(
+		TEXT("KDTree.FindNearest"), TEXT("Uniform"), InSize, [&]()
+		{
+			int64 Checksum = 0;
+			double Dist = 0;
+			for (const FVector& Probe : Probes)
+			{
+				const int32 Best = Tree.FindNearest(Probe, Dist);
+				if (Best != -1) { Checksum += Tree.GetItem(Best).Index; }
+			}
+			return Checksum;
+		});
+
+	Measure(
+		TEXT("KDTree.FindKNearest"), TEXT("Uniform"), InSize, [&]()
+		{
+			int64 Checksum = 0;
+			TArray<TPair<int32, double>> Neighbors;
+			for (const FVector& Probe : Probes)
+			{
+				Tree.FindKNearest(Probe, 8, Neighbors);
+				for (const TPair<int32, double>& Neighbor : Neighbors) { Checksum += Tree.GetItem(Neighbor.Key).Index; }
+			}
+			return Checksum;
+		});
+}
+
+void UPCGExBenchmarkCommandlet::RunUnionGraph(const int32 InSize)
+{
+	constexpr double Tolerance = 10;
+
+	TArray<FVector> Positions;
+	TArray<uint64> Edges;
+	PCGExBenchmark::Generators::PlanarGraph(InSize, 0.35, Seed, Positions, Edges);
+
+	// Second copy is jittered within tolerance, so most of it fuses with the first
+	TArray<FVector> Jittered = Positions;
+	FRandomStream Random(Seed + 2);
+	for (FVector& P : Jittered)
+	{
+		const double X = Random.FRandRange(-Tolerance, Tolerance) * 0.25;
+		const double Y = Random.FRandRange(-Tolerance, Tolerance) * 0.25;
+		P += FVector(X, Y, 0);
+	}
+
+	FPCGExContext Context;
+	const UPCGBasePointData* Sources[2] = {PCGExBenchmark::MakePointData(&Context, Positions), PCGExBenchmark::MakePointData(&Context, Jittered)};
+	const FBox Bounds = FBox(Positions).ExpandBy(Tolerance * 2);
+	const FPCGExFuseDetails FuseDetails(false, Tolerance);
+
+	Measure(
+		TEXT("UnionGraph.InsertCollapse"), TEXT("Planar"), Positions.Num(), [&]()
+		{
+			const TSharedPtr<PCGExGraph::FUnionGraph> UnionGraph = MakeShared<PCGExGraph::FUnionGraph>(FuseDetails, Bounds);
+			if (!UnionGraph->Init(&Context)) { return static_cast<int64>(-1); }
+
+			// Thread-safe insertion path, as used when fusing many clusters at once
+			for (int32 IO = 0; IO < 2; IO++)
+			{
+				const UPCGBasePointData* Source = Sources[IO];
+				ParallelFor(
+					Edges.Num(), [&](const int32 i)
+					{
+						uint32 Start = 0;
+						uint32 End = 0;
+						PCGEx::H64(Edges[i], Start, End);
+						UnionGraph->InsertEdge(PCGExData::FConstPoint(Source, Start, IO), PCGExData::FConstPoint(Source, End, IO));
+					});
+			}
+
+			UnionGraph->Collapse();
+			return static_cast<int64>(UnionGraph->Nodes.Num()) << 32 | UnionGraph->Edges.Num();
+		});
+}
+
+void UPCGExBenchmarkCommandlet::RunSorter(const int32 InSize)
+{
+	TArray<FVector> Positions;
+	PCGExBenchmark::Generators::Grid(InSize, 100, Positions);
+
+	FPCGExContext Context;
+	const TSharedRef<PCGExData::FPointIO> PointIO = MakeShared<PCGExData::FPointIO>(Context.GetOrCreateHandle(), PCGExBenchmark::MakePointData(&Context, Positions));
+	const TSharedRef<PCGExData::FFacade> Facade = MakeShared<PCGExData::FFacade>(PointIO);
+
+	// Y first so every row is a block of ties the second rule has to break
+	TArray<FPCGExSortRuleConfig> Rules;
+	Rules.Emplace_GetRef().Selector.Update(TEXT("$Position.Y"));
+	Rules.Emplace_GetRef().Selector.Update(TEXT("$Position.X"));
+
+	// Grid points come out already sorted, start from a seeded shuffle instead
+	TArray<int32> Shuffled;
+	PCGEx::ArrayOfIndices(Shuffled, Positions.Num());
+	FRandomStream Random(Seed);
+	for (int32 i = Shuffled.Num() - 1; i > 0; i--) { Shuffled.Swap(i, Random.RandRange(0, i)); }
+
+	auto SortOnce = [&](const bool bBuildKeys)
+	{
+		const TSharedPtr<PCGExSorting::FPointSorter> Sorter = MakeShared<PCGExSorting::FPointSorter>(&Context, Facade, Rules);
+		if (!Sorter->Init(&Context)) { return static_cast<int64>(-1); }
+		if (bBuildKeys && !Sorter->BuildKeys()) { return static_cast<int64>(-1); }
+
+		TArray<int32> Order = Shuffled;
+		Sorter->Sort(Order);
+
+		return static_cast<int64>(FCrc::MemCrc32(Order.GetData(), Order.Num() * sizeof(int32)));
+	};
+
+	Measure(TEXT("Sorter.Compare"), TEXT("Grid"), InSize, [&]() { return SortOnce(false); });
+	Measure(TEXT("Sorter.Keys"), TEXT("Grid"), InSize, [&]() { return SortOnce(true); });
+}
+
+void UPCGExBenchmarkCommandlet::RunPathfinding(const int32 InSize)
+{
+	constexpr int32 NumQueries = 64;
+
+	TArray<FVector> Positions;
+	TArray<uint64> Edges;
+	PCGExBenchmark::Generators::PlanarGraph(InSize, 0.35, Seed, Positions, Edges);
+
+	const int32 NumNodes = Positions.Num();
+	if (NumNodes < 2) { return; }
+
+	FPCGExContext Context;
+	const UPCGBasePointData* VtxPoints = PCGExBenchmark::MakePointData(&Context, Positions);
+	const TSharedPtr<PCGExData::FPointIO> VtxIO = MakeShared<PCGExData::FPointIO>(Context.GetOrCreateHandle(), VtxPoints);
+	const TSharedPtr<PCGExData::FFacade> VtxFacade = MakeShared<PCGExData::FFacade>(VtxIO.ToSharedRef());
+
+	// Same layout BuildFrom(SubGraph) produces, minus the graph compilation : node index == point index
+	const TSharedPtr<PCGExCluster::FCluster> Cluster = MakeShared<PCGExCluster::FCluster>(VtxIO, nullptr, nullptr);
+	Cluster->NumRawVtx = NumNodes;
+	Cluster->NumRawEdges = Edges.Num();
+	Cluster->VtxTransforms = VtxPoints->GetConstTransformValueRange();
+
+	Cluster->Nodes->Reserve(NumNodes);
+	for (int32 i = 0; i < NumNodes; i++)
+	{
+		Cluster->Nodes->Emplace(i, i);
+		Cluster->Bounds += Positions[i];
+	}
+
+	Cluster->Edges->Reserve(Edges.Num());
+	for (int32 i = 0; i < Edges.Num(); i++)
+	{
+		uint32 Start = 0;
+		uint32 End = 0;
+		PCGEx::H64(Edges[i], Start, End);
+
+		Cluster->Edges->Emplace(i, Start, End, i, 0);
+		Cluster->GetNode(Start)->Link(End, i);
+		Cluster->GetNode(End)->Link(Start, i);
+	}
+
+	Cluster->Bounds = Cluster->Bounds.ExpandBy(10);
+	if (GetDefault<UPCGExGlobalSettings>()->bBuildFlatClusterAdjacency) { Cluster->BuildFlatAdjacency(); }
+
+	UPCGExHeuristicsFactoryShortestDistance* DistanceFactory = Context.ManagedObjects->New<UPCGExHeuristicsFactoryShortestDistance>();
+	DistanceFactory->WeightFactor = DistanceFactory->Config.WeightFactor;
+	DistanceFactory->Config.Init();
+	DistanceFactory->ConfigBase = DistanceFactory->Config;
+
+	const TArray<TObjectPtr<const UPCGExHeuristicsFactoryData>> Factories = {DistanceFactory};
+	const TSharedPtr<PCGExHeuristics::FHeuristicsHandler> Heuristics = MakeShared<PCGExHeuristics::FHeuristicsHandler>(&Context, VtxFacade, nullptr, Factories);
+	if (!Heuristics->IsValidHandler()) { return; }
+
+	Heuristics->PrepareForCluster(Cluster);
+	Heuristics->CompleteClusterPreparation();
+
+	TArray<TPair<int32, int32>> Pairs;
+	Pairs.Reserve(NumQueries);
+	FRandomStream Random(Seed + 3);
+	for (int32 i = 0; i < NumQueries; i++)
+	{
+		const int32 From = Random.RandHelper(NumNodes);
+		const int32 To = Random.RandHelper(NumNodes);
+		Pairs.Emplace(From, To);
+	}
+
+	auto RunSearch = [&](const TSubclassOf<UPCGExSearchInstancedFactory>& InSearchClass, const FString& InKernel)
+	{
+		const UPCGExSearchInstancedFactory* SearchFactory = Context.ManagedObjects->New<UPCGExSearchInstancedFactory>(GetTransientPackage(), InSearchClass.Get());
+		const TSharedPtr<FPCGExSearchOperation> SearchOperation = SearchFactory->CreateOperation();
+		SearchOperation->PrepareForCluster(Cluster.Get());
+
+		Measure(
+			InKernel, TEXT("Planar"), NumNodes, [&]()
+			{
+				int64 Checksum = 0;
+				for (int32 i = 0; i < Pairs.Num(); i++)
+				{
+					const TSharedPtr<PCGExPathfinding::FPathQuery> Query = MakeShared<PCGExPathfinding::FPathQuery>(
+						Cluster.ToSharedRef(), PCGExData::FConstPoint(VtxPoints, Pairs[i].Key), PCGExData::FConstPoint(VtxPoints, Pairs[i].Value), i);
+
+					// Picks are node indices already, skip the spatial resolution
+					Query->Seed.Node = Cluster->GetNode(Pairs[i].Key);
+					Query->Goal.Node = Cluster->GetNode(Pairs[i].Value);
+					Query->PickResolution = PCGExPathfinding::EQueryPickResolution::Success;
+
+					Query->FindPath(SearchOperation, Heuristics, nullptr);
+					Checksum += Query->PathNodes.Num();
+				}
+				return Checksum;
+			});
+	};
+
+	RunSearch(UPCGExSearchAStar::StaticClass(), TEXT("Search.AStar"));
+	RunSearch(UPCGExSearchBidirectionalAStar::StaticClass(), TEXT("Search.BidirectionalAStar"));
+	RunSearch(UPCGExSearchDijkstra::StaticClass(), TEXT("Search.Dijkstra"));
+}
+
+bool UPCGExBenchmarkCommandlet::WriteResults(const FString& InPath) const
+{
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(InPath), true);
+
+	FString Out;
+
+	if (FPaths::GetExtension(InPath).Equals(TEXT("json"), ESearchCase::IgnoreCase))
+	{
+		Out = TEXT("[\n");
+		for (int32 i = 0; i < Results.Num(); i++)
+		{
+			const PCGExBenchmark::FResult& R = Results[i];
+			Out += FString::Printf(
+				TEXT("  {\"kernel\": \"%s\", \"dataset\": \"%s\", \"size\": %d, \"iterations\": %d, \"min_ms\": %.4f, \"median_ms\": %.4f, \"mean_ms\": %.4f, \"checksum\": %lld}%s\n"),
+				*R.Kernel, *R.Dataset, R.Size, R.Iterations, R.MinMs, R.MedianMs, R.MeanMs, R.Checksum, i < Results.Num() - 1 ? TEXT(",") : TEXT(""));
+		}
+		Out += TEXT("]\n");
+	}
+	else
+	{
+		Out = TEXT("kernel,dataset,size,iterations,min_ms,median_ms,mean_ms,checksum\n");
+		for (const PCGExBenchmark::FResult& R : Results)
+		{
+			Out += FString::Printf(TEXT("%s,%s,%d,%d,%.4f,%.4f,%.4f,%lld\n"), *R.Kernel, *R.Dataset, R.Size, R.Iterations, R.MinMs, R.MedianMs, R.MeanMs, R.Checksum);
+		}
+	}
+
+	return FFileHelper::SaveStringToFile(Out, *InPath);
+}
@@ -0,0 +1,79 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+
+#include "PCGExBenchmarkCommandlet.generated.h"
+
+namespace PCGExBenchmark
+{
+	/** Deterministic synthetic inputs. Same seed, same data, on every platform. */
+	namespace Generators
+	{
+		/** Regular NxN grid with the given spacing, on the XY plane. */
+		PCGEXTENDEDTOOLKITEDITOR_API void Grid(const int32 NumPoints, const double Spacing, TArray<FVector>& OutPositions);
+
+		/** Bridson Poisson-disk cloud on the XY plane, stops once NumPoints samples are accepted or the domain is saturated. */
+		PCGEXTENDEDTOOLKITEDITOR_API void PoissonCloud(const int32 NumPoints, const double Radius, const int32 Seed, TArray<FVector>& OutPositions);
+
+		/** Uniform cloud inside a cube. */
+		PCGEXTENDEDTOOLKITEDITOR_API void UniformCloud(const int32 NumPoints, const double Extent, const int32 Seed, TArray<FVector>& OutPositions);
+
+		/** Random planar graph : delaunay edges of a Poisson cloud, with a seeded fraction of them dropped. */
+		PCGEXTENDEDTOOLKITEDITOR_API void PlanarGraph(const int32 NumPoints, const double DropRatio, const int32 Seed, TArray<FVector>& OutPositions, TArray<uint64>& OutEdges);
+
+		/** 4-connected grid graph edges matching Grid() */
+		PCGEXTENDEDTOOLKITEDITOR_API void GridGraph(const int32 NumPoints, TArray<uint64>& OutEdges);
+	}
+
+	struct PCGEXTENDEDTOOLKITEDITOR_API FResult
+	{
+		FString Kernel;
+		FString Dataset;
+		int32 Size = 0;
+		int32 Iterations = 0;
+		double MinMs = 0;
+		double MedianMs = 0;
+		double MeanMs = 0;
+		int64 Checksum = 0; // Kernel-specific output summary, catches silent behavior changes alongside timings
+	};
+}
+
+/**
+ * Times core PCGEx kernels against seeded synthetic data and writes machine-readable results.
+ * Runs headless : UnrealEditor-Cmd <Project> -run=PCGExBenchmark -nullrhi -unattended
+ * Options : -Sizes=1000,10000,100000 -Iterations=5 -Seed=1337 -Filter=<KernelSubstring> -Output=<File.csv|File.json>
+ */
+UCLASS()
+class PCGEXTENDEDTOOLKITEDITOR_API UPCGExBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UPCGExBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+protected:
+	TArray<int32> Sizes;
+	int32 Iterations = 5;
+	int32 Seed = 1337;
+	FString Filter;
+
+	TArray<PCGExBenchmark::FResult> Results;
+
+	/** Runs Kernel Iterations times (after one warmup), Kernel returns its checksum. */
+	void Measure(const FString& InKernel, const FString& InDataset, const int32 InSize, TFunctionRef<int64()> Kernel);
+
+	void RunDelaunay(const int32 InSize);
+	void RunGraph(const int32 InSize);
+	void RunKDTree(const int32 InSize);
+	void RunUnionGraph(const int32 InSize);
+	void RunSorter(const int32 InSize);
+	void RunPathfinding(const int32 InSize);
+
+	bool WriteResults(const FString& InPath) const;
+};